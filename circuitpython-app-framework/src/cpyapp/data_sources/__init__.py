@@ -7,6 +7,7 @@ theme parks, stocks, weather, and generic data fetching.
 
 # Base classes
 from .base import DataSource, HttpDataSource, StaticDataSource
+from .shared_fetch import SharedFetcher, shared_fetcher
 
 # Specific data sources
 from .theme_park import ThemeParkDataSource
@@ -55,6 +56,8 @@ __all__ = [
     'DataSource',
     'HttpDataSource',
     'StaticDataSource',
+    'SharedFetcher',
+    'shared_fetcher',
     
     # Specific data sources
     'ThemeParkDataSource',
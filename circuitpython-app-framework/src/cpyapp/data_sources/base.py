@@ -15,6 +15,7 @@ except ImportError:
 
 from ..utils.error_handler import ErrorHandler
 from ..utils.timer import Timer
+from .shared_fetch import shared_fetcher
 
 # Initialize logger
 logger = ErrorHandler("error_log")
@@ -49,6 +50,9 @@ class DataSource:
         # Rate limiting
         self._last_request_time = 0
         
+        # Set while get_data(force_refresh=True) is fetching
+        self._force_refresh = False
+        
         # Error tracking
         self._error_count = 0
         self._last_error = None
@@ -74,7 +78,11 @@ class DataSource:
         try:
             # Fetch fresh data
             logger.info(f"{self.name}: Fetching fresh data")
-            data = await self._fetch_data()
+            self._force_refresh = force_refresh
+            try:
+                data = await self._fetch_data()
+            finally:
+                self._force_refresh = False
             
             # Update cache
             self._cache = data
@@ -176,9 +184,14 @@ class HttpDataSource(DataSource):
     
     This class extends DataSource with HTTP-specific functionality
     like URL handling, headers, and response parsing.
+    
+    Requests go through a fetcher shared by every HttpDataSource in the
+    process: sources asking for the same URL and headers share one
+    request and its cached response (within each source's cache_ttl),
+    and rate_limit is enforced per host across all sources.
     """
     
-    def __init__(self, name, url=None, http_client=None, **kwargs):
+    def __init__(self, name, url=None, http_client=None, fetcher=None, **kwargs):
         """
         Initialize HTTP data source.
         
@@ -186,11 +199,13 @@ class HttpDataSource(DataSource):
             name: Name of the data source
             url: Base URL for the data source
             http_client: HTTP client instance to use
+            fetcher: SharedFetcher to use (default: the process-wide one)
             **kwargs: Additional arguments passed to DataSource
         """
         super().__init__(name, **kwargs)
         self.url = url
         self.http_client = http_client
+        self.fetcher = fetcher if fetcher is not None else shared_fetcher
         self.headers = {}
         
     def set_http_client(self, http_client):
@@ -210,22 +225,43 @@ class HttpDataSource(DataSource):
             raise RuntimeError(f"{self.name}: No URL configured")
             
         try:
-            response = await self.http_client.get(self.url, headers=self.headers)
-            
-            if not response:
-                raise RuntimeError(f"{self.name}: Empty response from {self.url}")
-                
-            # Try to parse as JSON
-            try:
-                data = json.loads(response.text if hasattr(response, 'text') else response)
-                return self.parse_data(data)
-            except ValueError:
-                # Not JSON, return raw text
-                return self.parse_data(response.text if hasattr(response, 'text') else response)
+            data = await self.fetcher.fetch(
+                self.url, self.headers, self._request,
+                ttl=self.cache_ttl, rate_limit=self.rate_limit,
+                force_refresh=self._force_refresh)
+            return self.parse_data(data)
                 
         except Exception as e:
             logger.error(e, f"{self.name}: HTTP request failed")
             raise
+            
+    async def _request(self, url, headers):
+        """
+        Make the HTTP request and decode the body.
+        
+        Args:
+            url: The URL to fetch
+            headers: Request headers
+            
+        Returns:
+            The decoded JSON, or the body text if it isn't JSON
+        """
+        response = await self.http_client.get(url, headers=headers)
+        
+        if not response:
+            raise RuntimeError(f"{self.name}: Empty response from {url}")
+            
+        text = response.text if hasattr(response, 'text') else response
+        # Try to parse as JSON
+        try:
+            return json.loads(text)
+        except ValueError:
+            # Not JSON, return raw text
+            return text
+            
+    async def _rate_limit_check(self):
+        """Rate limiting is per host, in the shared fetcher."""
+        pass
 
 
 class StaticDataSource(DataSource):
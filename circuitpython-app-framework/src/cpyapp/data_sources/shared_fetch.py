@@ -0,0 +1,146 @@
+"""
+Process-wide fetch layer shared by all HTTP data sources.
+
+Data sources that ask for the same URL share one request and one cached
+response, and requests to the same host share one rate limit, no matter
+how many widgets or zones created their own DataSource instances.
+"""
+import asyncio
+import time
+
+from ..utils.error_handler import ErrorHandler
+
+# Initialize logger
+logger = ErrorHandler("error_log")
+
+
+class _Flight:
+    """A request in progress that other callers can wait on."""
+
+    def __init__(self):
+        self.done = asyncio.Event()
+        self.result = None
+        self.error = None
+
+
+class SharedFetcher:
+    """
+    Single-flight request coalescing with a shared TTL cache.
+
+    Requests are keyed by URL and headers. While a request for a key is
+    in flight, other callers for the same key wait for its result
+    instead of starting their own. Successful results are cached and
+    served to any caller whose TTL they still satisfy. Before a request
+    goes out, it waits for the host's rate limit; the slot is reserved
+    up front so concurrent callers for one host are spaced out too.
+
+    Cached results are shared between callers, so treat them as
+    read-only.
+    """
+
+    def __init__(self, max_entries=16):
+        """
+        Initialize the fetcher.
+
+        Args:
+            max_entries: Maximum number of cached responses
+        """
+        self.max_entries = max_entries
+        self._cache = {}
+        self._in_flight = {}
+        self._next_slot = {}
+
+        # Counters for diagnostics and tests
+        self.requests = 0
+        self.cache_hits = 0
+        self.coalesced = 0
+
+    async def fetch(self, url, headers, request, ttl=300, rate_limit=1.0, force_refresh=False):
+        """
+        Get the response for a URL, sharing it with other callers.
+
+        Args:
+            url: The URL to fetch
+            headers: Request headers (part of the key)
+            request: Coroutine function request(url, headers) doing the fetch
+            ttl: Seconds a cached response is good for this caller
+            rate_limit: Minimum seconds between requests to the URL's host
+            force_refresh: Skip the cache (an in-flight request is still shared)
+
+        Returns:
+            The result of request(), possibly from another caller's request
+        """
+        key = _make_key(url, headers)
+
+        if not force_refresh:
+            entry = self._cache.get(key)
+            if entry is not None and time.monotonic() - entry[0] < ttl:
+                self.cache_hits += 1
+                return entry[1]
+
+        flight = self._in_flight.get(key)
+        if flight is not None:
+            self.coalesced += 1
+            logger.debug(f"Joining request in flight for {url}")
+            await flight.done.wait()
+            error = flight.error
+            if error is not None:
+                if isinstance(error, Exception) and not isinstance(error, asyncio.CancelledError):
+                    raise error
+                # The leading caller was cancelled, this one wasn't
+                raise OSError(f"Shared request for {url} was cancelled")
+            return flight.result
+
+        flight = _Flight()
+        self._in_flight[key] = flight
+        try:
+            await self._wait_for_host(_host(url), rate_limit)
+            self.requests += 1
+            flight.result = await request(url, headers)
+            self._store(key, flight.result)
+            return flight.result
+        except BaseException as e:
+            # Includes cancellation, so waiters never mistake it for a result
+            flight.error = e
+            raise
+        finally:
+            del self._in_flight[key]
+            flight.done.set()
+
+    def clear(self):
+        """Drop all cached responses."""
+        self._cache = {}
+
+    async def _wait_for_host(self, host, rate_limit):
+        """Wait for and reserve the host's next request slot."""
+        now = time.monotonic()
+        slot = max(now, self._next_slot.get(host, 0))
+        self._next_slot[host] = slot + rate_limit
+        if slot > now:
+            logger.debug(f"Rate limiting {host}, waiting {slot - now:.1f}s")
+            await asyncio.sleep(slot - now)
+
+    def _store(self, key, result):
+        """Cache a result, evicting the oldest entry when full."""
+        self._cache.pop(key, None)
+        if len(self._cache) >= self.max_entries:
+            oldest = min(self._cache, key=lambda k: self._cache[k][0])
+            del self._cache[oldest]
+        self._cache[key] = (time.monotonic(), result)
+
+
+def _make_key(url, headers):
+    """Build the cache key for a URL and headers."""
+    if not headers:
+        return url
+    return (url,) + tuple(sorted(headers.items()))
+
+
+def _host(url):
+    """Get the host part of a URL."""
+    rest = url.split("://", 1)[-1]
+    return rest.split("/", 1)[0]
+
+
+# Shared by every HttpDataSource in the process
+shared_fetcher = SharedFetcher()
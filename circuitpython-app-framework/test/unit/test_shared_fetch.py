@@ -0,0 +1,174 @@
+"""
+Unit tests for the shared fetch layer used by HTTP data sources.
+"""
+import asyncio
+import json
+import unittest
+from unittest.mock import patch, MagicMock
+
+from cpyapp.data_sources import SharedFetcher, UrlDataSource, ThemeParkDataSource
+
+
+class FakeHttpClient:
+    """HTTP client that counts requests and returns canned JSON."""
+    
+    def __init__(self, delay=0.01):
+        self.delay = delay
+        self.urls = []
+        
+    async def get(self, url, headers=None):
+        self.urls.append(url)
+        await asyncio.sleep(self.delay)
+        return MagicMock(text=json.dumps({"url": url, "rides": []}))
+
+
+class TestSharedFetcher(unittest.TestCase):
+    """Test request coalescing, caching and rate limiting."""
+    
+    def test_concurrent_requests_are_coalesced(self):
+        """Test that callers for one URL share the request in flight."""
+        fetcher = SharedFetcher()
+        client = FakeHttpClient()
+        sources = [UrlDataSource("https://example.com/a.json", http_client=client, fetcher=fetcher)
+                   for _ in range(3)]
+        
+        async def run():
+            return await asyncio.gather(*(source.get_data() for source in sources))
+        results = asyncio.run(run())
+        
+        self.assertEqual(client.urls, ["https://example.com/a.json"])
+        self.assertEqual(fetcher.coalesced, 2)
+        self.assertTrue(all(result == {"url": "https://example.com/a.json", "rides": []}
+                            for result in results))
+        
+    def test_cache_is_shared_within_ttl(self):
+        """Test that a second source reuses the first one's response."""
+        fetcher = SharedFetcher()
+        client = FakeHttpClient(delay=0)
+        first = UrlDataSource("https://example.com/a.json", http_client=client, fetcher=fetcher)
+        second = UrlDataSource("https://example.com/a.json", http_client=client, fetcher=fetcher)
+        no_cache = UrlDataSource("https://example.com/a.json", http_client=client,
+                                 fetcher=fetcher, cache_ttl=0)
+        
+        async def run():
+            await first.get_data()
+            await second.get_data()
+            await no_cache.get_data()
+            await first.get_data(force_refresh=True)
+        with patch('cpyapp.data_sources.shared_fetch.asyncio.sleep'):
+            asyncio.run(run())
+        
+        self.assertEqual(len(client.urls), 3)
+        self.assertEqual(fetcher.cache_hits, 1)
+        
+    def test_headers_are_part_of_the_key(self):
+        """Test that different headers aren't served each other's responses."""
+        fetcher = SharedFetcher()
+        client = FakeHttpClient(delay=0)
+        plain = UrlDataSource("https://example.com/a.json", http_client=client, fetcher=fetcher,
+                              rate_limit=0)
+        keyed = UrlDataSource("https://example.com/a.json", http_client=client, fetcher=fetcher,
+                              headers={"X-Api-Key": "k"}, rate_limit=0)
+        
+        async def run():
+            await plain.get_data()
+            await keyed.get_data()
+        asyncio.run(run())
+        
+        self.assertEqual(len(client.urls), 2)
+        
+    def test_distinct_urls_one_fetch_each(self):
+        """Test that zones showing overlapping parks fetch each park once."""
+        fetcher = SharedFetcher()
+        client = FakeHttpClient(delay=0)
+        zones = [
+            ThemeParkDataSource(park_id=[6, 5], http_client=client, fetcher=fetcher, rate_limit=0),
+            ThemeParkDataSource(park_id=6, http_client=client, fetcher=fetcher, rate_limit=0),
+            ThemeParkDataSource(preset='magic_kingdom', http_client=client, fetcher=fetcher, rate_limit=0),
+        ]
+        
+        async def run():
+            await asyncio.gather(*(zone.get_data() for zone in zones))
+        asyncio.run(run())
+        
+        self.assertEqual(sorted(client.urls), [
+            "https://queue-times.com/parks/5/queue_times.json",
+            "https://queue-times.com/parks/6/queue_times.json",
+        ])
+        
+    def test_rate_limit_is_per_host(self):
+        """Test that requests to one host are spaced by the rate limit."""
+        fetcher = SharedFetcher()
+        client = FakeHttpClient(delay=0)
+        sleeps = []
+        
+        async def fake_sleep(seconds):
+            sleeps.append(seconds)
+        
+        async def run():
+            for path in ("a", "b"):
+                source = UrlDataSource(f"https://example.com/{path}.json", http_client=client,
+                                       fetcher=fetcher, rate_limit=5)
+                await source.get_data()
+            other = UrlDataSource("https://other.example.com/c.json", http_client=client,
+                                  fetcher=fetcher, rate_limit=5)
+            await other.get_data()
+        with patch('cpyapp.data_sources.shared_fetch.asyncio.sleep', side_effect=fake_sleep):
+            asyncio.run(run())
+        
+        # The fake client's zero-length sleeps aren't rate limit waits
+        waits = [seconds for seconds in sleeps if seconds > 0]
+        self.assertEqual(len(waits), 1)
+        self.assertGreater(waits[0], 4)
+        
+    def test_errors_reach_every_waiter_and_are_not_cached(self):
+        """Test that a failed request fails its joiners and is retried later."""
+        fetcher = SharedFetcher()
+        calls = []
+        
+        async def failing_request(url, headers):
+            calls.append(url)
+            await asyncio.sleep(0.01)
+            raise OSError("offline")
+        
+        async def run():
+            results = await asyncio.gather(
+                fetcher.fetch("https://example.com/a", {}, failing_request, rate_limit=0),
+                fetcher.fetch("https://example.com/a", {}, failing_request, rate_limit=0),
+                return_exceptions=True)
+            self.assertTrue(all(isinstance(result, OSError) for result in results))
+            with self.assertRaises(OSError):
+                await fetcher.fetch("https://example.com/a", {}, failing_request, rate_limit=0)
+        asyncio.run(run())
+        
+        self.assertEqual(len(calls), 2)
+        
+    def test_cancelled_request_fails_its_waiters(self):
+        """Test that joiners of a cancelled request get an error, not its unset result."""
+        fetcher = SharedFetcher()
+        client = FakeHttpClient(delay=0.05)
+        
+        async def request(url, headers):
+            return await client.get(url)
+        
+        async def run():
+            leader = asyncio.ensure_future(
+                fetcher.fetch("https://example.com/a", {}, request, rate_limit=0))
+            await asyncio.sleep(0)
+            waiter = asyncio.ensure_future(
+                fetcher.fetch("https://example.com/a", {}, request, rate_limit=0))
+            await asyncio.sleep(0.01)
+            leader.cancel()
+            with self.assertRaises(OSError):
+                await waiter
+            self.assertTrue(leader.cancelled())
+            # Nothing was cached, so the next caller fetches again
+            return await fetcher.fetch("https://example.com/a", {}, request, rate_limit=0)
+        result = asyncio.run(run())
+        
+        self.assertEqual(len(client.urls), 2)
+        self.assertIn("example.com/a", result.text)
+
+
+if __name__ == '__main__':
+    unittest.main()
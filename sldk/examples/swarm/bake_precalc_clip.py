@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+Bake the Pre-calculated Swarm into an SLDK Clip
+
+precalc_player.py replays precalc_paths.json on the device, but it still
+parses the whole JSON file and moves 200 sprites every frame. This tool
+runs the same PathPlayer headless on the desktop, records every frame it
+shows with ClipBaker and saves them as a compact clip. On the device the
+clip plays through the 'clip' display strategy:
+
+    DisplayItem('clip', {'path': 'swarm.sldc', 'loops': 3})
+
+Usage:
+    python bake_precalc_clip.py [output.sldc]
+"""
+
+import sys
+import os
+import asyncio
+
+# Render to buffers on a virtual clock instead of opening a window
+os.environ.setdefault('SLDK_HEADLESS', '1')
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..', '..', '..', 'sldk', 'src'))
+
+from sldk.display.interface import DisplayInterface
+from sldk.display.clip import ClipBaker
+from sldk.display.timeline import Timeline
+from precalc_player import PathPlayer
+
+
+class PlayerDisplay(DisplayInterface):
+    """Lets ClipBaker record a PathPlayer's simulated display."""
+    
+    def __init__(self, player):
+        self.player = player
+    
+    @property
+    def width(self):
+        return self.player.device.width
+    
+    @property
+    def height(self):
+        return self.player.device.height
+    
+    async def show(self):
+        # PathPlayer.play_frame() has already refreshed the display
+        return True
+    
+    async def capture(self, pixels):
+        self.player.device.display.capture(pixels)
+        return True
+
+
+async def record(player, fps):
+    """Play every path frame through a ClipBaker.
+    
+    Args:
+        player: PathPlayer with its paths loaded
+        fps: Frame rate of the path data
+    
+    Returns:
+        ClipWriter holding the recorded frames
+    """
+    clock = player.device.clock
+    display = PlayerDisplay(player)
+    baker = ClipBaker(display, fps=fps, timeline=Timeline(clock.monotonic))
+    
+    async def animation():
+        while player.frame_index < len(player.frames):
+            player.play_frame()
+            await display.show()
+            clock.advance(1 / fps)
+    
+    return await baker.record(animation())
+
+
+def bake(output_file):
+    """Record the path animation into a clip.
+    
+    Args:
+        output_file: Clip file to write
+    
+    Returns:
+        Tuple of (frame count, clip size in bytes)
+    """
+    # PathPlayer loads precalc_paths.json from the working directory
+    os.chdir(os.path.dirname(os.path.abspath(__file__)))
+    player = PathPlayer()
+    writer = asyncio.run(record(player, player.metadata['fps']))
+    return len(writer.frames), writer.save(output_file)
+
+
+if __name__ == "__main__":
+    here = os.path.dirname(os.path.abspath(__file__))
+    output = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, 'swarm.sldc')
+    output = os.path.abspath(output)
+    frames, size = bake(output)
+    print(f"Baked {frames} frames into {output}: {size} bytes "
+          f"(JSON paths: {os.path.getsize(os.path.join(here, 'precalc_paths.json'))} bytes)")
@@ -43,6 +43,7 @@ except ImportError:
 
 import gc
 from ..display.content import ContentQueue
+from ..display.timeline import get_timeline
 
 
 class SLDKApp:
@@ -54,20 +55,26 @@ class SLDKApp:
     3. Web server process - Optional, runs if memory allows
     """
     
-    def __init__(self, enable_web=True, update_interval=300):
+    def __init__(self, enable_web=True, update_interval=300, update_jitter=0.0):
         """Initialize SLDK application.
         
         Args:
             enable_web: Whether to enable web server (if memory allows)
             update_interval: Data update interval in seconds
+            update_jitter: Fraction of the interval to randomize each wait
+                by (e.g. 0.1 for +/-10%) so many devices don't poll in sync
         """
         self.enable_web = enable_web
         self.update_interval = update_interval
+        self.update_jitter = update_jitter
         self.running = False
         self.display = None
         self.content_queue = ContentQueue()
         self._tasks = []
         
+        # Display frames per second, paced by the shared timeline
+        self.frame_rate = 20
+        
         # Memory tracking
         self._last_memory_report = 0
         self._memory_report_interval = 60  # Report every minute
@@ -89,6 +96,22 @@ class SLDKApp:
         """
         pass  # Optional - subclass can override if needed
     
+    def next_update_interval(self):
+        """Get the seconds to wait before the next data update.
+        
+        Called after every update. The default is update_interval with
+        update_jitter applied; override to poll adaptively, e.g. back off
+        while the data isn't changing or its source is closed.
+        
+        Returns:
+            Seconds to wait
+        """
+        if not self.update_jitter:
+            return self.update_interval
+        import random
+        spread = self.update_interval * self.update_jitter
+        return max(0, self.update_interval + random.uniform(-spread, spread))
+    
     async def prepare_display_content(self):
         """Prepare content for display.
         
@@ -110,9 +133,13 @@ class SLDKApp:
     async def _display_process(self):
         """Process 1: Handle display updates."""
         print("Display process started")
+        frames = get_timeline().frames(self.frame_rate)
         
         while self.running:
             try:
+                # Wait for the next frame deadline, dropping any we missed
+                await frames.wait()
+                
                 # Get content to display
                 content = await self.prepare_display_content()
                 
@@ -126,15 +153,13 @@ class SLDKApp:
                     # Update display
                     await self.display.show()
                 
-                # Control frame rate
-                await sleep(0.05)  # 20 FPS
-                
                 # Report memory periodically
                 await self._report_memory()
                 
             except Exception as e:
                 print(f"Display error: {e}")
                 await sleep(1)
+                frames.reset()
     
     async def _data_update_process(self):
         """Process 2: Handle data updates."""
@@ -149,7 +174,7 @@ class SLDKApp:
         while self.running:
             try:
                 # Wait for update interval
-                await sleep(self.update_interval)
+                await sleep(self.next_update_interval())
                 
                 # Check if we have enough memory
                 gc.collect()
@@ -0,0 +1,490 @@
+"""Pre-baked animation clips for SLDK.
+
+Animations too heavy to compute on the device (physics, flocking, big
+effects) are baked on the desktop into a compact clip and replayed on
+the device without any of the original work. Frames are palette indexed,
+run-length encoded and stored as deltas against the previous frame, and
+playback streams them from flash one frame at a time.
+
+Clip layout (little-endian):
+    Header:  magic b'SLDC', version (u8), width (u16), height (u16),
+             frame count (u16), fps (u8), palette size (u16),
+             largest frame payload in bytes (u32)
+    Palette: palette size entries of R, G, B bytes
+    Frames:  kind (u8), payload length (u32), payload
+
+Key frame payloads are (run, index) byte pairs covering every pixel in
+row order. Delta payloads are (skip low, skip high, run, index) byte
+groups: leave skip pixels unchanged, then paint run pixels with the
+palette color. An empty delta repeats the previous frame.
+"""
+
+import struct
+from array import array
+
+from .interface import draw_pixels
+from .strategy import DisplayStrategy, register_strategy
+from .timeline import get_timeline
+
+CLIP_MAGIC = b'SLDC'
+CLIP_VERSION = 1
+HEADER_FORMAT = '<4sBHHHBHI'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+FRAME_HEADER_FORMAT = '<BI'
+FRAME_HEADER_SIZE = struct.calcsize(FRAME_HEADER_FORMAT)
+
+FRAME_KEY = 0
+FRAME_DELTA = 1
+
+MAX_PALETTE = 256
+MAX_RUN = 255
+MAX_SKIP = 0xFFFF
+
+# Pixels handed to set_pixels per call during playback
+BATCH_SIZE = 256
+
+
+class ClipWriter:
+    """Builds a clip from full frames of 24-bit colors.
+    
+    Frames can come from anywhere: a captured display, a simulator
+    matrix, or an animation drawn straight into a pixel array.
+    """
+    
+    def __init__(self, width, height, fps=20):
+        """Initialize the writer.
+        
+        Args:
+            width: Frame width in pixels
+            height: Frame height in pixels
+            fps: Playback frames per second (1 to 255)
+        """
+        if not 1 <= fps <= 255:
+            raise ValueError(f"Clip fps must be 1-255, got {fps}")
+        self.width = width
+        self.height = height
+        self.fps = fps
+        self.frames = []
+    
+    def add_frame(self, pixels):
+        """Append a frame.
+        
+        Args:
+            pixels: width * height colors, row by row
+        """
+        if len(pixels) != self.width * self.height:
+            raise ValueError(f"Frame has {len(pixels)} pixels, expected "
+                             f"{self.width * self.height}")
+        self.frames.append(array('L', pixels))
+    
+    def to_bytes(self):
+        """Encode the clip.
+        
+        Colors are reduced to a palette of at most 256 entries, dropping
+        low color bits only when the frames hold more colors than that.
+        
+        Returns:
+            bytes: Encoded clip
+        """
+        if len(self.frames) > 0xFFFF:
+            raise ValueError(f"Clip has {len(self.frames)} frames, limit is 65535")
+        palette, lookup, shift = _build_palette(self.frames)
+        mask = _channel_mask(shift)
+        
+        body = bytearray()
+        largest = 0
+        previous = None
+        for frame in self.frames:
+            indices = bytes(lookup[color & mask] for color in frame)
+            key = _encode_key(indices)
+            kind, payload = FRAME_KEY, key
+            if previous is not None:
+                delta = _encode_delta(previous, indices)
+                if len(delta) < len(key):
+                    kind, payload = FRAME_DELTA, delta
+            body += struct.pack(FRAME_HEADER_FORMAT, kind, len(payload))
+            body += payload
+            largest = max(largest, len(payload))
+            previous = indices
+        
+        header = struct.pack(HEADER_FORMAT, CLIP_MAGIC, CLIP_VERSION,
+                             self.width, self.height, len(self.frames),
+                             self.fps, len(palette), largest)
+        colors = bytearray()
+        for color in palette:
+            colors += bytes(((color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF))
+        return header + bytes(colors) + bytes(body)
+    
+    def save(self, path):
+        """Write the encoded clip to a file.
+        
+        Args:
+            path: Output file path
+        
+        Returns:
+            int: Size of the clip in bytes
+        """
+        data = self.to_bytes()
+        with open(path, 'wb') as f:
+            f.write(data)
+        return len(data)
+
+
+def _channel_mask(shift):
+    """Mask that drops the low shift bits of each color channel."""
+    channel = (0xFF << shift) & 0xFF
+    return (channel << 16) | (channel << 8) | channel
+
+
+def _build_palette(frames):
+    """Find a palette of at most MAX_PALETTE colors for the frames.
+    
+    Returns:
+        Tuple of (palette colors, color to index dict, bits dropped per channel)
+    """
+    colors = set()
+    for frame in frames:
+        colors.update(frame)
+    shift = 0
+    reduced = colors
+    while len(reduced) > MAX_PALETTE:
+        shift += 1
+        mask = _channel_mask(shift)
+        reduced = set(color & mask for color in colors)
+    palette = sorted(reduced)
+    lookup = {color: index for index, color in enumerate(palette)}
+    return palette, lookup, shift
+
+
+def _encode_key(indices):
+    """Run-length encode every pixel of a frame."""
+    out = bytearray()
+    count = len(indices)
+    i = 0
+    while i < count:
+        index = indices[i]
+        run = 1
+        while i + run < count and run < MAX_RUN and indices[i + run] == index:
+            run += 1
+        out.append(run)
+        out.append(index)
+        i += run
+    return out
+
+
+def _encode_delta(previous, indices):
+    """Run-length encode the pixels that changed since the previous frame."""
+    out = bytearray()
+    count = len(indices)
+    skip = 0
+    i = 0
+    while i < count:
+        if indices[i] == previous[i]:
+            skip += 1
+            i += 1
+            continue
+        while skip > MAX_SKIP:
+            # Gap too long for one group; skip ahead with an empty run
+            out += bytes((0xFF, 0xFF, 0, 0))
+            skip -= MAX_SKIP
+        index = indices[i]
+        run = 1
+        while (i + run < count and run < MAX_RUN and indices[i + run] == index
+               and indices[i + run] != previous[i + run]):
+            run += 1
+        out += bytes((skip & 0xFF, skip >> 8, run, index))
+        skip = 0
+        i += run
+    return out
+
+
+def read_header(stream):
+    """Read and check a clip header without touching the rest of the file.
+    
+    Args:
+        stream: Binary file object positioned at the start of the clip
+    
+    Returns:
+        Tuple of (width, height, frame count, fps, palette size,
+        largest frame payload)
+    """
+    header = stream.read(HEADER_SIZE)
+    if len(header) < HEADER_SIZE:
+        raise ValueError("Clip is truncated")
+    fields = struct.unpack(HEADER_FORMAT, header)
+    if fields[0] != CLIP_MAGIC:
+        raise ValueError("Not an SLDK clip")
+    if fields[1] != CLIP_VERSION:
+        raise ValueError(f"Unsupported clip version: {fields[1]}")
+    return fields[2:]
+
+
+class ClipReader:
+    """Streams a clip's frames from a file to a display.
+    
+    Only the header, the palette and one frame's payload are held in
+    memory, plus small fixed buffers for batching pixels to the display.
+    """
+    
+    def __init__(self, stream):
+        """Read the clip header and palette.
+        
+        Args:
+            stream: Binary file object positioned at the start of the clip
+        """
+        (self.width, self.height, self.frame_count, self.fps,
+         palette_size, largest) = read_header(stream)
+        
+        raw = stream.read(palette_size * 3)
+        self.palette = array('L', [0] * palette_size)
+        for i in range(palette_size):
+            self.palette[i] = (raw[i * 3] << 16) | (raw[i * 3 + 1] << 8) | raw[i * 3 + 2]
+        
+        self.stream = stream
+        self.frame = 0
+        self._frames_offset = HEADER_SIZE + palette_size * 3
+        self._payload = bytearray(largest)
+        self._frame_header = bytearray(FRAME_HEADER_SIZE)
+        self._xs = array('h', [0] * BATCH_SIZE)
+        self._ys = array('h', [0] * BATCH_SIZE)
+        self._colors = array('L', [0] * BATCH_SIZE)
+    
+    @property
+    def duration(self):
+        """Length of one pass through the clip in seconds."""
+        return self.frame_count / self.fps
+    
+    def rewind(self):
+        """Go back to the first frame."""
+        self.stream.seek(self._frames_offset)
+        self.frame = 0
+    
+    async def draw_next(self, display):
+        """Draw the next frame's changes to the display.
+        
+        Args:
+            display: Display interface
+        
+        Returns:
+            True if a frame was drawn, False at the end of the clip
+        """
+        if self.frame >= self.frame_count:
+            return False
+        self.stream.readinto(self._frame_header)
+        kind, length = struct.unpack(FRAME_HEADER_FORMAT, self._frame_header)
+        payload = memoryview(self._payload)[:length]
+        self.stream.readinto(payload)
+        if kind == FRAME_KEY:
+            await self._draw_key(display, payload, length)
+        else:
+            await self._draw_delta(display, payload, length)
+        self.frame += 1
+        return True
+    
+    async def _draw_key(self, display, payload, length):
+        """Paint every pixel from (run, index) pairs."""
+        width = self.width
+        palette = self.palette
+        xs = self._xs
+        ys = self._ys
+        colors = self._colors
+        x = 0
+        y = 0
+        n = 0
+        for i in range(0, length, 2):
+            color = palette[payload[i + 1]]
+            for _ in range(payload[i]):
+                xs[n] = x
+                ys[n] = y
+                colors[n] = color
+                n += 1
+                if n == BATCH_SIZE:
+                    await draw_pixels(display, xs, ys, colors, n)
+                    n = 0
+                x += 1
+                if x == width:
+                    x = 0
+                    y += 1
+        if n:
+            await draw_pixels(display, xs, ys, colors, n)
+    
+    async def _draw_delta(self, display, payload, length):
+        """Paint changed pixels from (skip, run, index) groups."""
+        width = self.width
+        palette = self.palette
+        xs = self._xs
+        ys = self._ys
+        colors = self._colors
+        position = 0
+        n = 0
+        for i in range(0, length, 4):
+            position += payload[i] | (payload[i + 1] << 8)
+            run = payload[i + 2]
+            if not run:
+                continue
+            color = palette[payload[i + 3]]
+            y = position // width
+            x = position - y * width
+            position += run
+            for _ in range(run):
+                xs[n] = x
+                ys[n] = y
+                colors[n] = color
+                n += 1
+                if n == BATCH_SIZE:
+                    await draw_pixels(display, xs, ys, colors, n)
+                    n = 0
+                x += 1
+                if x == width:
+                    x = 0
+                    y += 1
+        if n:
+            await draw_pixels(display, xs, ys, colors, n)
+    
+    async def play(self, display, loops=1, timeline=None):
+        """Play the clip at its frame rate.
+        
+        Frames follow the timeline's deadlines. When drawing falls behind,
+        the late frames are still decoded (each delta builds on the one
+        before) but only the newest is shown.
+        
+        Args:
+            display: Display interface
+            loops: Number of times to play the clip
+            timeline: Timeline to pace on; defaults to the global timeline
+        
+        Returns:
+            int: Number of frames shown
+        """
+        frames = (timeline or get_timeline()).frames(self.fps)
+        shown = 0
+        for _ in range(loops):
+            self.rewind()
+            playing = True
+            while playing:
+                due = await frames.wait()
+                drawn = 0
+                for _ in range(due):
+                    if not await self.draw_next(display):
+                        playing = False
+                        break
+                    drawn += 1
+                if drawn:
+                    await display.show()
+                    shown += 1
+        return shown
+
+
+class ClipBaker:
+    """Records an animation running on a display into a clip.
+    
+    Every show() is captured with its time on the timeline, and the
+    captures are resampled to the clip's frame rate, so the animation
+    can pace itself however it likes. Run the bake under the simulator's
+    VirtualClock to record a long animation without waiting for it.
+    """
+    
+    def __init__(self, display, fps=20, timeline=None):
+        """Initialize the baker.
+        
+        Args:
+            display: Display interface that supports capture()
+            fps: Frame rate of the baked clip
+            timeline: Timeline to timestamp captures; defaults to the global one
+        """
+        self.display = display
+        self.fps = fps
+        self.timeline = timeline or get_timeline()
+        self.captures = []
+    
+    async def record(self, animation):
+        """Run an animation and record what it shows.
+        
+        Args:
+            animation: Awaitable that draws to the display, such as
+                effect.apply(display, render_func)
+        
+        Returns:
+            ClipWriter holding the resampled frames
+        """
+        display = self.display
+        size = display.width * display.height
+        show = display.show
+        start = self.timeline.now()
+        
+        async def capturing_show():
+            await show()
+            pixels = array('L', [0] * size)
+            if not await display.capture(pixels):
+                raise ValueError("Display can't capture frames for baking")
+            self.captures.append((self.timeline.now() - start, pixels))
+        
+        overridden = 'show' in getattr(display, '__dict__', {})
+        display.show = capturing_show
+        try:
+            await animation
+        finally:
+            if overridden:
+                display.show = show
+            else:
+                # Let the class method show through again
+                del display.show
+        return self.build()
+    
+    def build(self):
+        """Resample the captures into a clip.
+        
+        Returns:
+            ClipWriter with one frame per 1 / fps seconds
+        """
+        writer = ClipWriter(self.display.width, self.display.height, self.fps)
+        if not self.captures:
+            return writer
+        end = self.captures[-1][0]
+        count = int(end * self.fps + 1e-6) + 1
+        current = 0
+        for frame in range(count):
+            moment = frame / self.fps + 1e-6
+            while (current + 1 < len(self.captures)
+                   and self.captures[current + 1][0] <= moment):
+                current += 1
+            writer.add_frame(self.captures[current][1])
+        return writer
+
+
+@register_strategy('clip')
+class ClipStrategy(DisplayStrategy):
+    """Strategy that plays a pre-baked clip from flash.
+    
+    Data:
+        path: Clip file path
+        loops: Times to play the clip (default 1)
+    """
+    
+    async def render(self, display, data):
+        """Play the clip."""
+        with open(data['path'], 'rb') as f:
+            reader = ClipReader(f)
+            # Frames are drawn pixel by pixel, not through the scene
+            await display.set_direct_drawing(True)
+            try:
+                await reader.play(display, data.get('loops', 1))
+            finally:
+                await display.set_direct_drawing(False)
+    
+    def validate_data(self, data):
+        """Validate clip data."""
+        return 'path' in data
+    
+    def get_render_duration(self, data):
+        """Get the clip length from its header.
+        
+        Only the header is read; the palette and frame buffers a
+        ClipReader allocates aren't needed to answer this.
+        """
+        try:
+            with open(data['path'], 'rb') as f:
+                _, _, frame_count, fps, _, _ = read_header(f)
+        except (OSError, ValueError):
+            return None
+        return frame_count / fps * data.get('loops', 1)
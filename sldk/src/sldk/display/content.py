@@ -12,6 +12,8 @@ except (ImportError, AttributeError):
     import time
     get_time = lambda: time.monotonic()
 
+from .timeline import get_timeline
+
 
 class DisplayContent:
     """Base class for displayable content."""
@@ -85,7 +87,11 @@ class StaticText(DisplayContent):
 
 
 class ScrollingText(DisplayContent):
-    """Scrolling text display content."""
+    """Scrolling text display content.
+    
+    The position follows the shared timeline, so the text moves at speed
+    pixels per second however often it is rendered.
+    """
     
     def __init__(self, text, x=None, y=0, color=0xFFFFFF, speed=30):
         """Initialize scrolling text.
@@ -104,6 +110,8 @@ class ScrollingText(DisplayContent):
         self.color = color
         self.speed = speed
         self._position = None
+        self._origin = None
+        self._scroll_start = None
         self._text_width = None
     
     async def start(self):
@@ -117,18 +125,24 @@ class ScrollingText(DisplayContent):
         # Initialize position on first render
         if self._position is None:
             if self.x is None:
-                self._position = display.width
+                self._origin = display.width
             else:
-                self._position = self.x
+                self._origin = self.x
+            self._position = self._origin
+            self._scroll_start = get_timeline().now()
             # Estimate text width (6 pixels per char as default)
             self._text_width = len(self.text) * 6
+        elif self.speed > 0:
+            # Move left to where the clock says the text should be
+            scrolled = get_timeline().now() - self._scroll_start
+            self._position = self._origin - int(scrolled * self.speed)
+        else:
+            # No usable speed; step one pixel per frame
+            self._position -= 1
         
         # Draw text at current position
         await display.draw_text(self.text, self._position, self.y, self.color)
         
-        # Move text left
-        self._position -= 1
-        
         # Check if scrolling is complete
         if self._position < -self._text_width:
             self._is_complete = True
@@ -111,6 +111,26 @@ class MatrixPortalS3Display(DisplayInterface):
         if self.matrix and 0 <= x < self._width and 0 <= y < self._height:
             self.matrix[x, y] = color
     
+    async def set_pixels(self, xs, ys, colors, count):
+        """Set many pixels in one call.
+        
+        Args:
+            xs: X coordinates
+            ys: Y coordinates
+            colors: Colors as 24-bit RGB integers
+            count: Number of entries to use
+        """
+        matrix = self.matrix
+        if not matrix:
+            return
+        width = self._width
+        height = self._height
+        for i in range(count):
+            x = xs[i]
+            y = ys[i]
+            if 0 <= x < width and 0 <= y < height:
+                matrix[x, y] = colors[i]
+    
     async def fill(self, color):
         """Fill entire display with color.
         
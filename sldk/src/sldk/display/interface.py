@@ -42,6 +42,45 @@ class DisplayInterface:
         """
         raise NotImplementedError("Subclass must implement set_pixel()")
     
+    async def set_pixels(self, xs, ys, colors, count):
+        """Set many pixels in one call.
+        
+        Args:
+            xs: X coordinates
+            ys: Y coordinates
+            colors: Colors as 24-bit RGB integers
+            count: Number of entries to use from the start of each sequence
+        """
+        # Default implementation using set_pixel
+        for i in range(count):
+            await self.set_pixel(xs[i], ys[i], colors[i])
+    
+    async def capture(self, pixels):
+        """Read the current frame back into a pixel buffer.
+        
+        Args:
+            pixels: Buffer of width * height entries, filled row by row
+                with 24-bit RGB colors
+            
+        Returns:
+            True if the frame was captured, False if this display can't
+            read its pixels back
+        """
+        return False
+    
+    async def set_direct_drawing(self, enabled):
+        """Keep pixels drawn with set_pixel() on screen across show().
+        
+        Displays that retain a scene of groups and labels redraw it on
+        show(), covering anything drawn pixel by pixel. While enabled,
+        show() puts the drawn pixels on screen instead. Displays that
+        draw pixels straight to the screen ignore this.
+        
+        Args:
+            enabled: True while a caller owns the pixels
+        """
+        pass
+    
     async def fill(self, color):
         """Fill entire display with color.
         
@@ -86,4 +125,24 @@ class DisplayInterface:
             speed: Scroll speed in seconds per pixel
         """
         # Subclasses should override with efficient scrolling
-        pass
\ No newline at end of file
+        pass
+
+
+async def draw_pixels(display, xs, ys, colors, count):
+    """Write a batch of pixels to any display.
+    
+    DisplayInterface displays get a single set_pixels() call; duck-typed
+    displays only promise set_pixel(), so they get one call per pixel.
+    
+    Args:
+        display: Display to draw on
+        xs: X coordinates
+        ys: Y coordinates
+        colors: Colors as 24-bit RGB integers
+        count: Number of entries to use from the start of each sequence
+    """
+    if isinstance(display, DisplayInterface):
+        await display.set_pixels(xs, ys, colors, count)
+        return
+    for i in range(count):
+        await display.set_pixel(xs[i], ys[i], colors[i])
@@ -140,6 +140,14 @@ class DisplayManager:
         """
         return self.queue.add_item(item)
     
+    def set_transition(self, effect) -> None:
+        """Set the transition played between consecutive items.
+        
+        Args:
+            effect: Effect instance such as CrossFadeEffect, or None for a cut
+        """
+        self.queue.set_transition(effect)
+    
     def clear_queue(self) -> None:
         """Clear all items from the display queue."""
         self.queue.clear()
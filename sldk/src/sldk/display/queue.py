@@ -38,6 +38,9 @@ class DisplayQueue:
         self._item_start_time: Optional[float] = None
         self._on_item_expired: Optional[Callable] = None
         
+        # Effect played when one item replaces another, e.g. CrossFadeEffect
+        self.transition = None
+        
         # Statistics
         self.stats = {
             'items_processed': 0,
@@ -83,6 +86,17 @@ class DisplayQueue:
         
         return True
     
+    def set_transition(self, effect) -> None:
+        """Set the transition between consecutive items.
+        
+        The transition is applied to each incoming item that has no effects
+        of its own, whenever it replaces an item that was on the display.
+        
+        Args:
+            effect: Effect instance such as CrossFadeEffect, or None for a cut
+        """
+        self.transition = effect
+    
     def _make_room_for_item(self, new_item: DisplayItem) -> bool:
         """Try to make room for a new item by removing lower priority items.
         
@@ -134,6 +148,7 @@ class DisplayQueue:
             return False
         
         # Start processing new item
+        previous_item = self._current_item
         self._current_item = next_item
         self._item_start_time = time.time()
         
@@ -146,8 +161,11 @@ class DisplayQueue:
                 raise ValueError(f"Unknown strategy: {next_item.strategy_name}")
             
             # Apply effects if any
-            if next_item.effects:
-                await self._apply_effects(strategy, display, next_item)
+            effects = next_item.effects
+            if not effects and self.transition and previous_item is not None:
+                effects = [self.transition]
+            if effects:
+                await self._apply_effects(strategy, display, next_item, effects)
             else:
                 await strategy.render(display, next_item.data)
             
@@ -161,13 +179,15 @@ class DisplayQueue:
             self._item_start_time = None
             return await self.process_next(display)  # Try next item
     
-    async def _apply_effects(self, strategy, display, item: DisplayItem) -> None:
+    async def _apply_effects(self, strategy, display, item: DisplayItem,
+                             effects: Optional[list] = None) -> None:
         """Apply effects to the rendering process.
         
         Args:
             strategy: Strategy instance to render with
             display: Display interface
             item: DisplayItem with effects
+            effects: Effects to apply instead of the item's own
         """
         # Create a render function for effects to call
         async def render_func():
@@ -175,7 +195,7 @@ class DisplayQueue:
         
         # Apply effects in order
         current_render_func = render_func
-        for effect in reversed(item.effects):  # Apply in reverse order
+        for effect in reversed(effects or item.effects):  # Apply in reverse order
             effect_render_func = current_render_func
             
             async def apply_effect():
@@ -192,7 +212,8 @@ class DisplayQueue:
         Returns:
             True if current item should continue, False if it should end
         """
-        if not self._current_item or not self._item_start_time:
+        # A start time of 0.0 is valid on a virtual clock
+        if not self._current_item or self._item_start_time is None:
             return False
         
         # Check if item has expired
@@ -143,28 +143,15 @@ class SimulatorDisplay(DisplayInterface):
             # Update display
             self.display.refresh(minimum_frames_per_second=0)
             
-            # Render to pygame
-            if hasattr(self.matrix, 'render'):
-                self.matrix.render()
-                
-                # Copy matrix surface to main window
-                if pygame.get_init() and pygame.display.get_surface():
-                    screen = pygame.display.get_surface()
-                    matrix_surface = self.matrix.get_surface()
-                    if matrix_surface:
-                        # Clear screen first
-                        screen.fill((0, 0, 0))
-                        # Blit matrix surface to screen
-                        screen.blit(matrix_surface, (0, 0))
-                        # Debug: Draw a test pattern to ensure window is working
-                        pygame.draw.circle(screen, (255, 0, 0), (10, 10), 5)  # Red dot in corner
-                    else:
-                        # No matrix surface, draw debug pattern
-                        screen.fill((50, 0, 50))  # Purple background
-                        pygame.draw.rect(screen, (255, 255, 0), (50, 50, 100, 50))  # Yellow rect
-            
+            # Render to pygame, pushing only the changed areas of the matrix
             if pygame.get_init() and pygame.display.get_surface():
-                pygame.display.flip()
+                screen = pygame.display.get_surface()
+                if hasattr(self.matrix, 'present'):
+                    dirty_rects = self.matrix.present(screen)
+                    if dirty_rects:
+                        pygame.display.update(dirty_rects)
+                else:
+                    pygame.display.flip()
             
             # Small yield for responsiveness
             await asyncio.sleep(0.001)
@@ -200,6 +187,51 @@ class SimulatorDisplay(DisplayInterface):
             else:
                 print(f"Matrix object has no set_pixel method: {type(self.matrix)}")
     
+    async def set_pixels(self, xs, ys, colors, count):
+        """Set many pixels in one call.
+        
+        Args:
+            xs: X coordinates
+            ys: Y coordinates
+            colors: Colors as 24-bit RGB integers
+            count: Number of entries to use
+        """
+        if not self.matrix or not hasattr(self.matrix, 'set_pixel'):
+            # Let set_pixel work out how to address this matrix
+            await super().set_pixels(xs, ys, colors, count)
+            return
+        set_pixel = self.matrix.set_pixel
+        width = self._width
+        height = self._height
+        for i in range(count):
+            x = xs[i]
+            y = ys[i]
+            if 0 <= x < width and 0 <= y < height:
+                set_pixel(x, y, colors[i])
+    
+    async def capture(self, pixels):
+        """Read the current frame back into a pixel buffer.
+        
+        Args:
+            pixels: Buffer of width * height entries for 24-bit RGB colors
+            
+        Returns:
+            True if the frame was captured
+        """
+        if not self.display or not hasattr(self.display, 'capture'):
+            return False
+        self.display.capture(pixels)
+        return True
+    
+    async def set_direct_drawing(self, enabled):
+        """Keep pixels drawn with set_pixel() on screen across show().
+        
+        Args:
+            enabled: True while a caller owns the pixels
+        """
+        if self.display and hasattr(self.display, 'direct_drawing'):
+            self.display.direct_drawing = enabled
+    
     async def fill(self, color):
         """Fill entire display with color.
         
@@ -287,7 +319,7 @@ class SimulatorDisplay(DisplayInterface):
         Args:
             title: Window title
         """
-        if self._window_created:
+        if self._window_created or getattr(self.device, 'headless', False):
             return
             
         try:
@@ -319,6 +351,10 @@ class SimulatorDisplay(DisplayInterface):
             screen.fill((50, 50, 50))  # Dark gray background
             pygame.display.flip()
             
+            # The new window needs every LED drawn once
+            if hasattr(self.matrix, 'invalidate'):
+                self.matrix.invalidate()
+            
             print(f"Window created successfully: {title}")
             self._window_created = True
             
@@ -0,0 +1,307 @@
+"""Shared animation timeline for SLDK.
+
+One monotonic clock drives effects, scrolls and transitions. Frames are
+scheduled against deadlines instead of sleeping a fixed time after each
+render, so an animation's length doesn't grow with the render cost. When
+rendering falls behind, the missed frames are skipped and animations
+jump ahead to where the clock says they should be.
+"""
+
+import time
+
+try:
+    # CircuitPython compatibility
+    import asyncio
+except ImportError:
+    asyncio = None
+
+
+# Easing functions map linear progress (0.0 to 1.0) to eased progress.
+# ease_in_out and bounce are the curves cpyapp's AnimationMixin uses for
+# its scroll styles, so styles and effects ease alike.
+
+def linear(t):
+    """No easing."""
+    return t
+
+
+def ease_in(t):
+    """Start slow and speed up."""
+    return t * t
+
+
+def ease_out(t):
+    """Start fast and slow down."""
+    return 1 - (1 - t) * (1 - t)
+
+
+def ease_in_out(t):
+    """Start and end slowly (smoothstep)."""
+    return t * t * (3.0 - 2.0 * t)
+
+
+def bounce(t):
+    """Creep away from 0, jump past 1 at the midpoint and settle back."""
+    if t < 0.5:
+        return 8 * t * t * t * t
+    t = t - 1
+    return 1 + 8 * t * t * t * t
+
+
+EASINGS = {
+    'linear': linear,
+    'ease_in': ease_in,
+    'ease_out': ease_out,
+    'ease_in_out': ease_in_out,
+    'bounce': bounce,
+}
+
+
+def get_easing(easing):
+    """Resolve an easing name or function.
+    
+    Args:
+        easing: Name from EASINGS, a function, or None for linear
+    
+    Returns:
+        Easing function; unknown names fall back to linear
+    """
+    if callable(easing):
+        return easing
+    return EASINGS.get(easing, linear)
+
+
+class Timeline:
+    """The clock shared by everything that animates."""
+    
+    def __init__(self, clock=None):
+        """Initialize the timeline.
+        
+        Args:
+            clock: Function returning seconds; defaults to time.monotonic
+        """
+        self._clock = clock
+    
+    def now(self):
+        """Get the current time in seconds."""
+        if self._clock:
+            return self._clock()
+        return time.monotonic()
+    
+    def animate(self, duration, easing='linear'):
+        """Start an animation now.
+        
+        Args:
+            duration: Length in seconds
+            easing: Easing name or function
+        
+        Returns:
+            Animation
+        """
+        return Animation(self, duration, easing)
+    
+    def frames(self, fps):
+        """Create a deadline-based frame scheduler on this clock.
+        
+        Args:
+            fps: Frames per second
+        
+        Returns:
+            FrameScheduler
+        """
+        return FrameScheduler(self, fps)
+
+
+class Animation:
+    """Progress of one timed animation, read from the timeline's clock."""
+    
+    def __init__(self, timeline, duration, easing='linear'):
+        """Initialize the animation, starting now.
+        
+        Args:
+            timeline: Timeline to read time from
+            duration: Length in seconds
+            easing: Easing name or function
+        """
+        self.timeline = timeline
+        self.duration = duration
+        self.easing = get_easing(easing)
+        self.start_time = timeline.now()
+    
+    @property
+    def elapsed(self):
+        """Seconds since the animation started."""
+        return self.timeline.now() - self.start_time
+    
+    @property
+    def progress(self):
+        """Linear progress from 0.0 to 1.0."""
+        if self.duration <= 0:
+            return 1.0
+        progress = self.elapsed / self.duration
+        if progress < 0.0:
+            return 0.0
+        return 1.0 if progress > 1.0 else progress
+    
+    @property
+    def value(self):
+        """Eased progress."""
+        return self.easing(self.progress)
+    
+    @property
+    def done(self):
+        """Whether the animation has run its full duration."""
+        return self.progress >= 1.0
+    
+    def step(self, steps):
+        """Get the nearest of a number of discrete steps.
+        
+        Args:
+            steps: Number of steps in the whole animation
+        
+        Returns:
+            Step from 0 to steps for the eased progress
+        """
+        step = int(self.value * steps + 0.5)
+        return steps if step > steps else step
+
+
+class FrameScheduler:
+    """Paces a render loop against fixed frame deadlines.
+    
+    Deadlines are frame_duration apart from the first frame. If a frame is
+    late, every deadline that has already passed is skipped, so the loop
+    drops frames rather than running behind the clock.
+    """
+    
+    def __init__(self, timeline, fps):
+        """Initialize the scheduler.
+        
+        Args:
+            timeline: Timeline to read time from
+            fps: Frames per second
+        """
+        self.timeline = timeline
+        self.frame_duration = 1.0 / fps
+        self.frame = 0
+        self.skipped = 0
+        self._deadline = None
+    
+    def reset(self):
+        """Make the next frame due immediately."""
+        self._deadline = None
+    
+    def ready(self):
+        """Claim the current frame if it's due, without waiting.
+        
+        The first call is always due.
+        
+        Returns:
+            True if a frame is due now
+        """
+        now = self.timeline.now()
+        if self._deadline is None:
+            self._deadline = now
+        elif now < self._deadline:
+            return False
+        self._advance(now)
+        return True
+    
+    async def wait(self):
+        """Wait for the next frame deadline.
+        
+        The first call returns at once. A late frame still yields to other
+        tasks, so a loop that can't keep up doesn't starve them.
+        
+        Returns:
+            Frames advanced; more than 1 when late frames were skipped
+        """
+        now = self.timeline.now()
+        if self._deadline is None:
+            self._deadline = now
+        else:
+            delay = self._deadline - now
+            await _sleep(delay if delay > 0 else 0)
+            now = self.timeline.now()
+        return self._advance(now)
+    
+    def _advance(self, now):
+        """Move past the due deadline and any that were missed."""
+        missed = int((now - self._deadline) / self.frame_duration)
+        if missed < 0:
+            # The clock woke slightly early; treat it as on time
+            missed = 0
+        self.skipped += missed
+        self.frame += 1 + missed
+        self._deadline += (1 + missed) * self.frame_duration
+        return 1 + missed
+
+
+async def play_steps(steps, duration, draw, start=0, easing='linear',
+                     timeline=None):
+    """Draw the steps of a timed animation on their frame deadlines.
+    
+    Frames run at steps / duration per second and each draws the step the
+    clock has reached. A frame that lands on an already drawn step draws
+    nothing, and a late frame jumps straight to the current step, so the
+    animation ends on time however long drawing takes. Without a duration
+    every step is drawn back to back.
+    
+    Steps only move forward, since a step may draw on top of the last
+    one. An easing that overshoots (bounce) holds the final step until
+    the duration is up, one that dips back holds its furthest step, and
+    the final step is always drawn when the duration ends.
+    
+    Args:
+        steps: Number of the final step
+        duration: Animation length in seconds
+        draw: Async function taking the step to draw
+        start: First step to draw
+        easing: Easing name or function
+        timeline: Timeline to run on; defaults to the global timeline
+    
+    Returns:
+        Number of steps drawn
+    """
+    if duration <= 0 or steps <= 0:
+        for step in range(start, steps + 1):
+            await draw(step)
+        return max(0, steps + 1 - start)
+    
+    timeline = timeline or get_timeline()
+    animation = timeline.animate(duration, easing)
+    frames = timeline.frames(steps / duration)
+    drawn = 0
+    last = start - 1
+    while True:
+        await frames.wait()
+        # The clock, not the curve, decides when the animation is over
+        done = animation.done
+        step = steps if done else animation.step(steps)
+        if step > last:
+            await draw(step)
+            drawn += 1
+            last = step
+        if done:
+            return drawn
+
+
+async def _sleep(seconds):
+    """Sleep, yielding to other tasks when asyncio is available."""
+    if asyncio:
+        await asyncio.sleep(seconds)
+    else:
+        time.sleep(seconds)
+
+
+# Global timeline shared by effects, content and the app display loop
+_global_timeline = Timeline()
+
+
+def get_timeline():
+    """Get the global timeline.
+    
+    Returns:
+        Global Timeline instance
+    """
+    return _global_timeline
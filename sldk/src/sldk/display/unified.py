@@ -212,17 +212,13 @@ class UnifiedDisplay(DisplayInterface):
             
             # Update pygame display - use same pattern as DisplayManager
             screen = pygame.display.get_surface()
-            if screen and hasattr(self.matrix, 'render') and hasattr(self.matrix, 'get_surface'):
-                # Clear screen
-                screen.fill((0, 0, 0))
-                
-                # Render matrix and blit to screen
-                self.matrix.render()
-                matrix_surface = self.matrix.get_surface()
-                if matrix_surface:
-                    screen.blit(matrix_surface, (0, 0))
-                        
-            pygame.display.flip()
+            if screen and hasattr(self.matrix, 'present'):
+                # Copy and push only the changed areas of the matrix
+                dirty_rects = self.matrix.present(screen)
+                if dirty_rects:
+                    pygame.display.update(dirty_rects)
+            else:
+                pygame.display.flip()
             
             # Small yield for responsiveness
             await asyncio.sleep(0.001)
@@ -259,6 +255,51 @@ class UnifiedDisplay(DisplayInterface):
             else:
                 print(f"Matrix object has no set_pixel method: {type(self.matrix)}")
     
+    async def set_pixels(self, xs, ys, colors, count):
+        """Set many pixels in one call.
+        
+        Args:
+            xs: X coordinates
+            ys: Y coordinates
+            colors: Colors as 24-bit RGB integers
+            count: Number of entries to use
+        """
+        if not self.matrix or not hasattr(self.matrix, 'set_pixel'):
+            # Let set_pixel work out how to address this matrix
+            await super().set_pixels(xs, ys, colors, count)
+            return
+        set_pixel = self.matrix.set_pixel
+        width = self._width
+        height = self._height
+        for i in range(count):
+            x = xs[i]
+            y = ys[i]
+            if 0 <= x < width and 0 <= y < height:
+                set_pixel(x, y, colors[i])
+    
+    async def capture(self, pixels):
+        """Read the current frame back into a pixel buffer.
+        
+        Args:
+            pixels: Buffer of width * height entries for 24-bit RGB colors
+            
+        Returns:
+            True if the frame was captured
+        """
+        if not self.display or not hasattr(self.display, 'capture'):
+            return False
+        self.display.capture(pixels)
+        return True
+    
+    async def set_direct_drawing(self, enabled):
+        """Keep pixels drawn with set_pixel() on screen across show().
+        
+        Args:
+            enabled: True while a caller owns the pixels
+        """
+        if self.display and hasattr(self.display, 'direct_drawing'):
+            self.display.direct_drawing = enabled
+    
     async def fill(self, color):
         """Fill entire display with color.
         
@@ -346,8 +387,8 @@ class UnifiedDisplay(DisplayInterface):
         Args:
             title: Window title
         """
-        if IS_CIRCUITPYTHON:
-            # No window needed on hardware
+        if IS_CIRCUITPYTHON or getattr(self.device, 'headless', False):
+            # No window needed on hardware or in headless mode
             return
             
         try:
@@ -368,6 +409,10 @@ class UnifiedDisplay(DisplayInterface):
             screen = pygame.display.set_mode((width, height))
             pygame.display.set_caption(title)
             
+            # The new window needs every LED drawn once
+            if hasattr(self.matrix, 'invalidate'):
+                self.matrix.invalidate()
+            
         except ImportError:
             pass  # Pygame not available
     
@@ -5,9 +5,12 @@ These effects work with the strategy system and can modify how content
 is rendered to create visual enhancements.
 """
 
+import time
 from abc import ABC, abstractmethod
 from typing import Dict, Type, Callable, Any
 
+from .framebuffer import FrameBuffer
+
 try:
     # CircuitPython compatibility
     import asyncio
@@ -136,26 +139,52 @@ def get_effect_registry() -> EffectRegistry:
     return _global_effect_registry
 
 
+def _is_layer(effect) -> bool:
+    """Check whether an effect renders into a shared frame buffer."""
+    return getattr(effect, 'renders_frame', False) is True
+
+
+def _effect_duration(effect) -> float:
+    """Get an effect's duration, treating an open-ended layer as zero."""
+    if hasattr(effect, 'get_total_duration'):
+        return effect.get_total_duration()
+    return effect.duration or 0
+
+
 class CompositeEffect(Effect):
-    """Effect that combines multiple effects in sequence or parallel."""
+    """Effect that combines multiple effects in sequence or parallel.
     
-    def __init__(self, effects: list, mode: str = 'sequence', **kwargs):
+    In parallel mode, frame effects (those with renders_frame, such as
+    SparkleEffect or EdgeGlowEffect) are layered over the content each
+    frame: the content renders, then every layer blends into one shared
+    FrameBuffer, which is drawn in a single set_pixels call. At most one
+    Effect may drive the animation through apply(); without one, the
+    composite runs its own frame loop at fps.
+    """
+    
+    def __init__(self, effects: list, mode: str = 'sequence', fps: int = 10, **kwargs):
         """Initialize composite effect.
         
         Args:
-            effects: List of Effect instances
+            effects: List of Effect instances, or frame effects in parallel mode
             mode: 'sequence' or 'parallel'
+            fps: Frame rate of a parallel composite with no driving effect
             **kwargs: Additional parameters
         """
         # Calculate total duration
         if mode == 'sequence':
             total_duration = sum(effect.get_total_duration() for effect in effects)
         else:  # parallel
-            total_duration = max(effect.get_total_duration() for effect in effects) if effects else 0
+            drivers = [effect for effect in effects if not _is_layer(effect)]
+            if len(drivers) > 1:
+                raise ValueError("A parallel composite can have only one apply() effect; "
+                                 "the rest must render to a frame")
+            total_duration = max(_effect_duration(effect) for effect in effects) if effects else 0
         
         super().__init__(duration=total_duration, **kwargs)
         self.effects = effects
         self.mode = mode
+        self.fps = fps
     
     async def apply(self, display, render_func: Callable) -> None:
         """Apply composite effect."""
@@ -183,18 +212,41 @@ class CompositeEffect(Effect):
         await current_render_func()
     
     async def _apply_parallel(self, display, render_func: Callable) -> None:
-        """Apply effects in parallel."""
+        """Apply effects in parallel, compositing every layer in one pass per frame."""
         if not self.effects:
             await render_func()
             return
         
-        # For parallel effects, we need to coordinate them
-        # This is more complex and may need coordination
-        # For now, just apply the first effect
-        if self.effects:
-            await self.effects[0].apply(display, render_func)
-        else:
+        layers = [effect for effect in self.effects if _is_layer(effect)]
+        drivers = [effect for effect in self.effects if not _is_layer(effect)]
+        frame = FrameBuffer(getattr(display, 'width', 64), getattr(display, 'height', 32))
+        start_time = time.monotonic()
+        
+        async def render_layers():
             await render_func()
+            elapsed = time.monotonic() - start_time
+            frame.begin()
+            for layer in layers:
+                if not layer.duration or elapsed <= layer.duration:
+                    layer.render(frame, elapsed)
+            await frame.flush(display)
+        
+        if drivers:
+            await drivers[0].apply(display, render_layers)
+            return
+        
+        # No effect drives the timing, so run the frames here
+        frame_duration = 1.0 / self.fps
+        while True:
+            await display.clear()
+            await render_layers()
+            await display.show()
+            if time.monotonic() - start_time >= self.duration:
+                break
+            if asyncio:
+                await asyncio.sleep(frame_duration)
+            else:
+                time.sleep(frame_duration)
 
 
 # Utility function for content classes
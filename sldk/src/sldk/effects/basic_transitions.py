@@ -7,6 +7,8 @@ LED matrices with CircuitPython performance constraints.
 import time
 from typing import Callable
 from .base import Effect, register_effect
+from .offscreen import OffscreenTransition, compose_area
+from ..display.timeline import play_steps
 
 try:
     # CircuitPython compatibility
@@ -66,8 +68,11 @@ class FadeInEffect(Effect):
 
 
 @register_effect('slide_in')
-class SlideInEffect(Effect):
-    """Slide in effect that moves content from off-screen."""
+class SlideInEffect(OffscreenTransition):
+    """Slide in effect that moves content from off-screen.
+    
+    The content is rendered once and each step shifts the captured frame.
+    """
     
     def __init__(self, 
                  duration: float = 1.0,
@@ -83,8 +88,29 @@ class SlideInEffect(Effect):
         super().__init__(duration=duration, **kwargs)
         self.direction = direction
     
-    async def apply(self, display, render_func: Callable) -> None:
-        """Apply slide in effect."""
+    def get_step_count(self, width: int, height: int) -> int:
+        """Get the number of slide steps, one per pixel up to 32."""
+        return min(width if self.direction in ['left', 'right'] else height, 32)
+    
+    def compose(self, source, dest, target, width: int, height: int,
+                progress: float) -> None:
+        """Copy the captured content shifted by the slide offset."""
+        distance = width if self.direction in ['left', 'right'] else height
+        offset_x, offset_y = self._calculate_slide_offset(distance, progress)
+        
+        for i in range(len(target)):
+            target[i] = 0
+        x_start = max(0, offset_x)
+        x_end = min(width, width + offset_x)
+        if x_end <= x_start:
+            return
+        for y in range(max(0, offset_y), min(height, height + offset_y)):
+            row = y * width
+            src_row = (y - offset_y) * width - offset_x
+            target[row + x_start:row + x_end] = dest[src_row + x_start:src_row + x_end]
+    
+    async def apply_live(self, display, render_func: Callable) -> None:
+        """Apply slide in effect by rendering the content for every step."""
         # Get display dimensions
         width = getattr(display, 'width', 64)
         height = getattr(display, 'height', 32)
@@ -97,9 +123,8 @@ class SlideInEffect(Effect):
         
         # Slide animation
         steps = min(slide_distance, 32)  # Limit steps for performance
-        step_duration = self.duration / steps if steps > 0 else 0
         
-        for step in range(steps + 1):
+        async def draw(step):
             progress = step / steps if steps > 0 else 1.0
             
             # Calculate offset based on direction and progress
@@ -115,13 +140,9 @@ class SlideInEffect(Effect):
             
             # Update display
             await display.show()
-            
-            # Wait for next step
-            if step < steps and step_duration > 0:
-                if asyncio:
-                    await asyncio.sleep(step_duration)
-                else:
-                    time.sleep(step_duration)
+        
+        await play_steps(steps, self.duration, draw,
+                         easing=self.params.get('easing', 'linear'))
     
     def _calculate_slide_offset(self, distance: int, progress: float) -> tuple:
         """Calculate slide offset for current progress.
@@ -175,8 +196,14 @@ class SlideInEffect(Effect):
 
 
 @register_effect('wipe')
-class WipeEffect(Effect):
-    """Wipe effect that replaces old content with new content."""
+class WipeEffect(OffscreenTransition):
+    """Wipe effect that replaces old content with new content.
+    
+    The outgoing frame is captured, the new content is rendered once, and
+    each step moves the edge between the two captures.
+    """
+    
+    uses_source = True
     
     def __init__(self, 
                  duration: float = 1.0,
@@ -192,11 +219,22 @@ class WipeEffect(Effect):
         super().__init__(duration=duration, **kwargs)
         self.direction = direction
     
-    async def apply(self, display, render_func: Callable) -> None:
-        """Apply wipe effect.
+    def get_step_count(self, width: int, height: int) -> int:
+        """Get the number of wipe steps, one per pixel."""
+        return width if self.direction in ['left', 'right'] else height
+    
+    def compose(self, source, dest, target, width: int, height: int,
+                progress: float) -> None:
+        """Show the new content inside the wiped area and the old outside."""
+        steps = self.get_step_count(width, height)
+        area = self._calculate_wipe_area(width, height, round(progress * steps), steps)
+        compose_area(source, dest, target, width, area)
+    
+    async def apply_live(self, display, render_func: Callable) -> None:
+        """Apply wipe effect by rendering the content for every step.
         
-        Note: This is a simplified implementation. A full wipe effect
-        would need to capture the previous display state.
+        Without a captured frame the old content can't be shown, so the
+        new content is wiped in over black.
         """
         # Get display dimensions
         width = getattr(display, 'width', 64)
@@ -208,10 +246,7 @@ class WipeEffect(Effect):
         else:  # up, down
             steps = height
         
-        step_duration = self.duration / steps if steps > 0 else 0
-        
-        # Perform wipe animation
-        for step in range(steps + 1):
+        async def draw(step):
             # Calculate wipe area
             wipe_area = self._calculate_wipe_area(width, height, step, steps)
             
@@ -223,13 +258,10 @@ class WipeEffect(Effect):
             
             # Update display
             await display.show()
-            
-            # Wait for next step
-            if step < steps and step_duration > 0:
-                if asyncio:
-                    await asyncio.sleep(step_duration)
-                else:
-                    time.sleep(step_duration)
+        
+        # Perform wipe animation
+        await play_steps(steps, self.duration, draw,
+                         easing=self.params.get('easing', 'linear'))
     
     def _calculate_wipe_area(self, width: int, height: int, 
                            step: int, total_steps: int) -> dict:
@@ -29,11 +29,30 @@ except ImportError:
     
     math = SimpleMath()
 
+from .framebuffer import FrameBuffer, BLEND_ADD, BLEND_ALPHA, BLEND_MAX
+from ..display.timeline import Timeline
+
+# Rainbow palette used by RainbowCycleEffect
+RAINBOW_COLORS = (
+    0xFF0000, 0xFF1A00, 0xFF3300, 0xFF4D00, 0xFF6600, 0xFF8000,
+    0xFF9900, 0xFFB300, 0xFFCC00, 0xFFE600, 0xFFFF00, 0xE6FF00,
+    0xCCFF00, 0xB3FF00, 0x99FF00, 0x80FF00, 0x66FF00, 0x4DFF00,
+    0x33FF00, 0x1AFF00, 0x00FF00, 0x00FF1A, 0x00FF33, 0x00FF4D,
+    0x00FF66, 0x00FF80, 0x00FF99, 0x00FFB3, 0x00FFCC, 0x00FFE6
+)
+
+# Seconds a sparkle lives
+SPARKLE_LIFE = 1.0
+
 
 class EffectsEngine:
     """Lightweight effects engine for ESP32-friendly visual effects.
     
     Designed to work within CircuitPython memory and performance constraints.
+    Effects that render to a frame are composited together in one shared
+    FrameBuffer, each with its own blend mode, and drawn with a single
+    set_pixels call per frame. Other effects still draw on the display
+    directly through update().
     """
     
     def __init__(self, max_effects=2, target_fps=5):
@@ -49,6 +68,10 @@ class EffectsEngine:
         
         self.active_effects = []
         self.last_frame_time = 0
+        self.frame = None
+        
+        # Frames fall on fixed deadlines; a late update skips the missed ones
+        self.scheduler = Timeline(lambda: get_time()).frames(target_fps)
         
         # Pre-allocated color tables to save memory
         self.rainbow_colors = [
@@ -62,13 +85,25 @@ class EffectsEngine:
         self.warm_colors = [0xFF4500, 0xFF6347, 0xFF7F50, 0xFFA500, 0xFFD700]
         self.cool_colors = [0x00FFFF, 0x87CEEB, 0x4169E1, 0x0000FF, 0x8A2BE2]
     
-    def add_effect(self, effect):
+    def add_effect(self, effect, blend_mode=None, opacity=None):
         """Add effect to active list.
         
+        Effects are layered in the order they are added, so later effects
+        blend over earlier ones. Blend modes only combine effect layers:
+        the first layer at a pixel blends against the frame's black base,
+        not the content on screen, so a lone BLEND_MULTIPLY layer turns
+        its pixels black.
+        
         Args:
             effect: Effect instance to add
+            blend_mode: Override the effect's blend mode
+            opacity: Override the effect's opacity
         """
         if len(self.active_effects) < self.max_effects:
+            if blend_mode is not None:
+                effect.blend_mode = blend_mode
+            if opacity is not None:
+                effect.opacity = opacity
             effect.start_time = get_time()
             self.active_effects.append(effect)
             return True
@@ -89,29 +124,56 @@ class EffectsEngine:
         Args:
             display: Display interface
         """
-        current_time = get_time()
-        
         # Frame rate limiting
-        if current_time - self.last_frame_time < self.frame_duration:
+        if not self.scheduler.ready():
             return
         
+        current_time = get_time()
         self.last_frame_time = current_time
         
-        # Update effects (backwards to allow removal during iteration)
+        # Drop expired effects (backwards to allow removal during iteration)
         for i in range(len(self.active_effects) - 1, -1, -1):
             effect = self.active_effects[i]
-            
-            # Check if effect is expired
             if effect.duration and (current_time - effect.start_time) > effect.duration:
                 self.active_effects.pop(i)
+        
+        # Composite every frame effect in one pass, bottom layer first
+        layers = [effect for effect in self.active_effects if _renders_frame(effect)]
+        if layers:
+            frame = self._frame_for(display)
+            frame.begin()
+            for effect in layers:
+                try:
+                    effect.render(frame, current_time - effect.start_time)
+                except Exception as e:
+                    print(f"Effect error: {e}")
+                    self.active_effects.remove(effect)
+            await frame.flush(display)
+        
+        # Effects that draw on the display themselves
+        for effect in list(self.active_effects):
+            if _renders_frame(effect):
                 continue
-            
-            # Update effect
             try:
                 await effect.update(display, current_time - effect.start_time)
             except Exception as e:
                 print(f"Effect error: {e}")
-                self.active_effects.pop(i)
+                self.active_effects.remove(effect)
+    
+    def _frame_for(self, display):
+        """Get the frame buffer for a display, reallocating if its size changed.
+        
+        Args:
+            display: Display interface
+            
+        Returns:
+            FrameBuffer: Shared frame buffer
+        """
+        frame = self.frame
+        if frame is None or frame.width != display.width or frame.height != display.height:
+            frame = FrameBuffer(display.width, display.height)
+            self.frame = frame
+        return frame
     
     def clear_effects(self):
         """Clear all active effects."""
@@ -162,17 +224,43 @@ class EffectsEngine:
         return (r << 16) | (g << 8) | b
 
 
+def _renders_frame(effect):
+    """Check whether an effect draws through render() into a frame buffer."""
+    return isinstance(effect, SimpleEffect) and effect.renders_frame
+
+
 class SimpleEffect:
-    """Base class for simple effects."""
+    """Base class for simple effects.
+    
+    Subclasses that set renders_frame implement render() as a pure function
+    of the elapsed time, blending their pixels into a shared FrameBuffer
+    with blend_mode and opacity.
+    """
     
-    def __init__(self, duration=None):
+    renders_frame = False
+    default_blend_mode = BLEND_ALPHA
+    
+    def __init__(self, duration=None, blend_mode=None, opacity=1.0):
         """Initialize effect.
         
         Args:
             duration: Effect duration in seconds (None = infinite)
+            blend_mode: How this layer blends with those beneath it
+            opacity: Layer strength from 0.0 to 1.0
         """
         self.duration = duration
         self.start_time = 0
+        self.blend_mode = blend_mode or self.default_blend_mode
+        self.opacity = opacity
+    
+    def render(self, frame, elapsed_time):
+        """Blend this effect's pixels for one frame.
+        
+        Args:
+            frame: FrameBuffer to draw into
+            elapsed_time: Time since effect started
+        """
+        raise NotImplementedError("Frame effects must implement render()")
     
     async def update(self, display, elapsed_time):
         """Update effect for current frame.
@@ -187,6 +275,8 @@ class SimpleEffect:
 class RainbowCycleEffect(SimpleEffect):
     """Rainbow color cycling effect."""
     
+    renders_frame = True
+    
     def __init__(self, speed=1.0, duration=None):
         """Initialize rainbow cycle.
         
@@ -207,41 +297,49 @@ class RainbowCycleEffect(SimpleEffect):
         
         self.last_update_time = elapsed_time
         
+        width = display.width
+        rainbow_color, frame_offset, size = self._sweep(elapsed_time, width, display.height)
+        for i in range(4):  # Update 4 pixels max per frame
+            pixel_index = (frame_offset + i) % size
+            await display.set_pixel(pixel_index % width, pixel_index // width, rainbow_color)
+    
+    def render(self, frame, elapsed_time):
+        """Blend the same few pixels per frame that update() draws.
+        
+        The rainbow creeps across the display rather than covering it,
+        so the content underneath stays visible and each frame costs
+        four blends. Pixels from earlier frames stay on screen until the
+        content is redrawn.
+        """
+        width = frame.width
+        rainbow_color, frame_offset, size = self._sweep(elapsed_time, width, frame.height)
+        mode = self.blend_mode
+        opacity = self.opacity
+        for i in range(4):
+            pixel_index = (frame_offset + i) % size
+            frame.blend(pixel_index % width, pixel_index // width, rainbow_color, mode, opacity)
+    
+    def _sweep(self, elapsed_time, width, height):
+        """Get the rainbow color and first pixel index for this frame.
+        
+        Returns:
+            tuple: (color, first pixel index, pixel count)
+        """
         # Calculate rainbow progression
         time_offset = (elapsed_time * self.speed * 0.1) % 1.0
-        
-        # Apply rainbow to all pixels (simplified for performance)
         color_index = int(time_offset * 30) % 30  # 30 rainbow colors
-        rainbow_color = [
-            0xFF0000, 0xFF1A00, 0xFF3300, 0xFF4D00, 0xFF6600, 0xFF8000,
-            0xFF9900, 0xFFB300, 0xFFCC00, 0xFFE600, 0xFFFF00, 0xE6FF00,
-            0xCCFF00, 0xB3FF00, 0x99FF00, 0x80FF00, 0x66FF00, 0x4DFF00,
-            0x33FF00, 0x1AFF00, 0x00FF00, 0x00FF1A, 0x00FF33, 0x00FF4D,
-            0x00FF66, 0x00FF80, 0x00FF99, 0x00FFB3, 0x00FFCC, 0x00FFE6
-        ][color_index]
-        
-        # Only update a few pixels per frame for performance
-        width = display.width
-        height = display.height
-        
-        # Update 4 pixels per frame in a pattern
-        frame_offset = int(elapsed_time * 10) % (width * height)
         
-        for i in range(4):  # Update 4 pixels max per frame
-            pixel_index = (frame_offset + i) % (width * height)
-            x = pixel_index % width
-            y = pixel_index // width
-            
-            # Slight color variation based on position
-            position_offset = (x + y) * 0.1
-            final_color = rainbow_color
-            
-            await display.set_pixel(x, y, final_color)
+        # Move along the display in row order, 10 pixels per second
+        size = width * height
+        return RAINBOW_COLORS[color_index], int(elapsed_time * 10) % size, size
 
 
 class SparkleEffect(SimpleEffect):
     """Simple sparkle effect with minimal memory usage."""
     
+    renders_frame = True
+    default_blend_mode = BLEND_ADD
+    
     def __init__(self, intensity=3, duration=None):
         """Initialize sparkle effect.
         
@@ -255,6 +353,7 @@ class SparkleEffect(SimpleEffect):
         self.sparkle_life = []
         self.last_spawn_time = 0
         self.spawn_interval = 0.3  # New sparkle every 300ms
+        self.seed = int(get_time() * 1000) & 0xFFFF
     
     async def update(self, display, elapsed_time):
         """Update sparkles."""
@@ -284,6 +383,29 @@ class SparkleEffect(SimpleEffect):
             color = (intensity << 16) | (intensity << 8) | intensity  # White
             
             await display.set_pixel(x, y, color)
+    
+    def render(self, frame, elapsed_time):
+        """Draw each sparkle slot's current sparkle.
+        
+        Slots start spawn_interval apart and respawn every SPARKLE_LIFE
+        seconds at a position hashed from the slot and its generation,
+        so no state is kept between frames.
+        """
+        mode = self.blend_mode
+        opacity = self.opacity
+        for slot in range(self.intensity):
+            slot_time = elapsed_time - slot * self.spawn_interval
+            if slot_time < 0:
+                continue
+            generation = int(slot_time // SPARKLE_LIFE)
+            life = slot_time - generation * SPARKLE_LIFE
+            
+            h = _hash(self.seed + slot * 7919 + generation * 104729)
+            x = (h >> 8) % frame.width
+            y = (h >> 20) % frame.height
+            
+            level = int(max(0, 1.0 - life / SPARKLE_LIFE) * 255)
+            frame.blend(x, y, (level << 16) | (level << 8) | level, mode, opacity)
 
 
 class PulseEffect(SimpleEffect):
@@ -326,6 +448,9 @@ class PulseEffect(SimpleEffect):
 class EdgeGlowEffect(SimpleEffect):
     """Simple edge glow effect."""
     
+    renders_frame = True
+    default_blend_mode = BLEND_MAX
+    
     def __init__(self, color=0x00FFFF, duration=None):
         """Initialize edge glow.
         
@@ -345,14 +470,7 @@ class EdgeGlowEffect(SimpleEffect):
         
         self.last_update = elapsed_time
         
-        # Calculate glow intensity
-        intensity = (math.sin(elapsed_time * 3) + 1) * 0.5  # 0 to 1
-        
-        # Extract color components
-        r = int(((self.color >> 16) & 0xFF) * intensity)
-        g = int(((self.color >> 8) & 0xFF) * intensity)
-        b = int((self.color & 0xFF) * intensity)
-        glow_color = (r << 16) | (g << 8) | b
+        glow_color = self._glow_color(elapsed_time)
         
         # Draw edges (top, bottom, left, right)
         width = display.width
@@ -367,11 +485,38 @@ class EdgeGlowEffect(SimpleEffect):
         for y in range(0, height, 2):  # Every other pixel for performance
             await display.set_pixel(0, y, glow_color)
             await display.set_pixel(width - 1, y, glow_color)
+    
+    def render(self, frame, elapsed_time):
+        """Blend the glowing border into the frame."""
+        glow_color = self._glow_color(elapsed_time)
+        mode = self.blend_mode
+        opacity = self.opacity
+        width = frame.width
+        height = frame.height
+        
+        for x in range(0, width, 2):
+            frame.blend(x, 0, glow_color, mode, opacity)
+            frame.blend(x, height - 1, glow_color, mode, opacity)
+        for y in range(0, height, 2):
+            frame.blend(0, y, glow_color, mode, opacity)
+            frame.blend(width - 1, y, glow_color, mode, opacity)
+    
+    def _glow_color(self, elapsed_time):
+        """Get the glow color scaled by its pulsing intensity."""
+        intensity = (math.sin(elapsed_time * 3) + 1) * 0.5  # 0 to 1
+        
+        r = int(((self.color >> 16) & 0xFF) * intensity)
+        g = int(((self.color >> 8) & 0xFF) * intensity)
+        b = int((self.color & 0xFF) * intensity)
+        return (r << 16) | (g << 8) | b
 
 
 class CornerFlashEffect(SimpleEffect):
     """Flash the corners of the display."""
     
+    renders_frame = True
+    default_blend_mode = BLEND_MAX
+    
     def __init__(self, color=0xFFFFFF, flash_duration=0.2, interval=1.0, duration=None):
         """Initialize corner flash.
         
@@ -400,4 +545,18 @@ class CornerFlashEffect(SimpleEffect):
             await display.set_pixel(0, 0, self.color)  # Top-left
             await display.set_pixel(width - 1, 0, self.color)  # Top-right
             await display.set_pixel(0, height - 1, self.color)  # Bottom-left
-            await display.set_pixel(width - 1, height - 1, self.color)  # Bottom-right
\ No newline at end of file
+            await display.set_pixel(width - 1, height - 1, self.color)  # Bottom-right
+    
+    def render(self, frame, elapsed_time):
+        """Blend the corners into the frame while a flash is active."""
+        if elapsed_time % self.interval >= self.flash_duration:
+            return
+        right = frame.width - 1
+        bottom = frame.height - 1
+        for x, y in ((0, 0), (right, 0), (0, bottom), (right, bottom)):
+            frame.blend(x, y, self.color, self.blend_mode, self.opacity)
+
+
+def _hash(value):
+    """Scramble an integer into a pseudo-random non-negative integer."""
+    return (value * 1103515245 + 12345) & 0x7fffffff
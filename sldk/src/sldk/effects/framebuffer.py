@@ -0,0 +1,173 @@
+"""Shared frame buffer for layering SLDK effects.
+
+Effects render into a FrameBuffer instead of the display. Each write is
+blended with whatever earlier layers left at that pixel, and the finished
+frame reaches the display in one set_pixels call.
+"""
+
+from array import array
+
+from ..display.interface import draw_pixels
+
+# Blend modes for combining a layer's color with the pixel beneath it
+BLEND_ADD = 'add'            # Channel sum, clamped at 255
+BLEND_MULTIPLY = 'multiply'  # Channel product, darkens toward black
+BLEND_ALPHA = 'alpha'        # Mix toward the layer color by opacity
+BLEND_MAX = 'max'            # Brighter of the two per channel
+
+BLEND_MODES = (BLEND_ADD, BLEND_MULTIPLY, BLEND_ALPHA, BLEND_MAX)
+
+
+def blend_color(dst, src, mode=BLEND_ALPHA, opacity=1.0):
+    """Blend one 24-bit RGB color onto another.
+    
+    Args:
+        dst: Color already in the frame
+        src: Color being drawn
+        mode: One of BLEND_MODES
+        opacity: Layer strength from 0.0 (no change) to 1.0 (full)
+    
+    Returns:
+        int: Blended color
+    """
+    if opacity <= 0.0:
+        return dst
+    dr = (dst >> 16) & 0xFF
+    dg = (dst >> 8) & 0xFF
+    db = dst & 0xFF
+    sr = (src >> 16) & 0xFF
+    sg = (src >> 8) & 0xFF
+    sb = src & 0xFF
+    
+    if mode == BLEND_ADD:
+        r = dr + int(sr * opacity)
+        g = dg + int(sg * opacity)
+        b = db + int(sb * opacity)
+        r = 255 if r > 255 else r
+        g = 255 if g > 255 else g
+        b = 255 if b > 255 else b
+    elif mode == BLEND_MULTIPLY:
+        r = dr * sr // 255
+        g = dg * sg // 255
+        b = db * sb // 255
+        if opacity < 1.0:
+            r = int(dr + (r - dr) * opacity)
+            g = int(dg + (g - dg) * opacity)
+            b = int(db + (b - db) * opacity)
+    elif mode == BLEND_MAX:
+        r = sr if sr > dr else dr
+        g = sg if sg > dg else dg
+        b = sb if sb > db else db
+        if opacity < 1.0:
+            r = int(dr + (r - dr) * opacity)
+            g = int(dg + (g - dg) * opacity)
+            b = int(db + (b - db) * opacity)
+    elif mode == BLEND_ALPHA:
+        if opacity >= 1.0:
+            return src & 0xFFFFFF
+        r = int(dr + (sr - dr) * opacity)
+        g = int(dg + (sg - dg) * opacity)
+        b = int(db + (sb - db) * opacity)
+    else:
+        raise ValueError(f"Unknown blend mode: {mode}")
+    
+    return (r << 16) | (g << 8) | b
+
+
+class FrameBuffer:
+    """One frame of effect pixels, composited before it is drawn.
+    
+    Pixels no layer touched this frame are left alone on the display, so
+    effects overlay the content underneath rather than replacing it. The
+    buffer can't read the display back, though: the first layer to touch
+    a pixel blends against base_color, not the content on screen. Blend
+    modes therefore combine effect layers with each other, and a touched
+    pixel replaces the content beneath it (a BLEND_MULTIPLY first layer
+    over black gives black).
+    """
+    
+    def __init__(self, width, height, base_color=0x000000):
+        """Initialize the frame buffer.
+        
+        Args:
+            width: Frame width in pixels
+            height: Frame height in pixels
+            base_color: Color beneath the first layer at every pixel
+        """
+        self.width = width
+        self.height = height
+        self.base_color = base_color
+        
+        size = width * height
+        self.pixels = array('L', [0] * size)
+        # Pixel indices in the order they were first touched this frame
+        self.touched = array('H' if size <= 0x10000 else 'L', [0] * size)
+        self.touched_count = 0
+        self._is_touched = bytearray(size)
+        
+        # Buffers handed to set_pixels on flush
+        self.pixel_x = array('h', [0] * size)
+        self.pixel_y = array('h', [0] * size)
+        self.pixel_color = array('L', [0] * size)
+    
+    def begin(self):
+        """Start a new frame with no pixels touched."""
+        is_touched = self._is_touched
+        touched = self.touched
+        for n in range(self.touched_count):
+            is_touched[touched[n]] = 0
+        self.touched_count = 0
+    
+    def get_pixel(self, x, y):
+        """Get the composited color at a pixel.
+        
+        Returns:
+            int: Color so far this frame, or base_color if untouched
+        """
+        i = y * self.width + x
+        return self.pixels[i] if self._is_touched[i] else self.base_color
+    
+    def blend(self, x, y, color, mode=BLEND_ALPHA, opacity=1.0):
+        """Blend a color into one pixel; off-frame pixels are ignored.
+        
+        Args:
+            x: X coordinate
+            y: Y coordinate
+            color: 24-bit RGB color
+            mode: One of BLEND_MODES
+            opacity: Layer strength from 0.0 to 1.0
+        """
+        if x < 0 or y < 0 or x >= self.width or y >= self.height:
+            return
+        i = y * self.width + x
+        if self._is_touched[i]:
+            dst = self.pixels[i]
+        else:
+            dst = self.base_color
+            self._is_touched[i] = 1
+            self.touched[self.touched_count] = i
+            self.touched_count += 1
+        self.pixels[i] = blend_color(dst, color, mode, opacity)
+    
+    async def flush(self, display):
+        """Draw every touched pixel to the display in one batch.
+        
+        Args:
+            display: Display interface
+        
+        Returns:
+            int: Number of pixels drawn
+        """
+        count = self.touched_count
+        width = self.width
+        pixel_x = self.pixel_x
+        pixel_y = self.pixel_y
+        colors = self.pixel_color
+        for n in range(count):
+            i = self.touched[n]
+            pixel_x[n] = i % width
+            pixel_y[n] = i // width
+            colors[n] = self.pixels[i]
+        
+        await draw_pixels(display, pixel_x, pixel_y, colors, count)
+        return count
@@ -0,0 +1,228 @@
+"""Offscreen transitions for SLDK.
+
+Transitions that render their content once, capture it into pixel
+buffers, and build every step by compositing those buffers. A step
+costs one pass over the pixels plus a set_pixels call for the pixels
+that changed, instead of a full content render.
+"""
+
+from array import array
+from typing import Callable
+
+from .base import Effect, register_effect
+from ..display.interface import DisplayInterface
+from ..display.timeline import play_steps
+
+
+class OffscreenTransition(Effect):
+    """Base class for transitions composited from captured frames.
+    
+    The outgoing frame is captured as the source when uses_source is set;
+    otherwise the source is black, as it is after display.clear(). The
+    incoming content is rendered once and captured as the destination.
+    Each step then fills the target buffer from the two captures, and
+    only pixels that differ from the previous step are written. Once the
+    transition ends the content is rendered again so the display holds
+    it live. Displays that can't capture fall back to apply_live().
+    
+    Steps follow the shared timeline, eased by the 'easing' parameter
+    (see sldk.display.timeline.EASINGS).
+    """
+    
+    uses_source = False
+    
+    async def apply(self, display, render_func: Callable) -> None:
+        """Apply the transition.
+        
+        Args:
+            display: Display interface to render to
+            render_func: Function that renders the incoming content
+        """
+        if not isinstance(display, DisplayInterface):
+            # Duck-typed displays have no way to read pixels back
+            await self.apply_live(display, render_func)
+            return
+        
+        width = display.width
+        height = display.height
+        size = width * height
+        
+        source = array('L', [0] * size)
+        if self.uses_source and not await display.capture(source):
+            await self.apply_live(display, render_func)
+            return
+        
+        await display.clear()
+        await render_func()
+        dest = array('L', [0] * size)
+        if not await display.capture(dest):
+            await self.apply_live(display, render_func)
+            return
+        
+        shown = array('L', source)
+        target = array('L', [0] * size)
+        xs = array('h', [0] * size)
+        ys = array('h', [0] * size)
+        colors = array('L', [0] * size)
+        
+        steps = max(1, self.get_step_count(width, height))
+        
+        async def draw(step):
+            self.compose(source, dest, target, width, height, step / steps)
+            count = _changed_pixels(target, shown, width, xs, ys, colors)
+            if count:
+                await display.set_pixels(xs, ys, colors, count)
+            await display.show()
+        
+        # Composite from the captures on a cleared display, keeping the
+        # display's own scene from being redrawn over the steps
+        await display.clear()
+        await display.set_direct_drawing(True)
+        try:
+            if self.uses_source:
+                await self._present_all(display, shown, width, height)
+            
+            # Steps land on the timeline's frame deadlines; late ones are skipped
+            await play_steps(steps, self.get_transition_duration(), draw, start=1,
+                             easing=self.params.get('easing', 'linear'))
+        finally:
+            await display.set_direct_drawing(False)
+        
+        # Hand the display back to the live content
+        await display.clear()
+        await render_func()
+        await display.show()
+        await self.finish()
+    
+    async def _present_all(self, display, pixels, width, height) -> None:
+        """Draw a whole captured frame."""
+        size = width * height
+        xs = array('h', (i % width for i in range(size)))
+        ys = array('h', (i // width for i in range(size)))
+        await display.set_pixels(xs, ys, pixels, size)
+        await display.show()
+    
+    def get_step_count(self, width: int, height: int) -> int:
+        """Get the number of steps the transition takes.
+        
+        Args:
+            width: Display width
+            height: Display height
+        
+        Returns:
+            Number of composited steps
+        """
+        return 20
+    
+    def get_transition_duration(self) -> float:
+        """Get the time spent stepping, excluding any pause afterwards."""
+        return self.duration
+    
+    def compose(self, source, dest, target, width: int, height: int,
+                progress: float) -> None:
+        """Fill the target buffer for one step.
+        
+        Args:
+            source: Outgoing frame
+            dest: Incoming frame
+            target: Buffer to fill
+            width: Display width
+            height: Display height
+            progress: Transition progress (0.0 to 1.0)
+        """
+        raise NotImplementedError("Subclass must implement compose()")
+    
+    async def apply_live(self, display, render_func: Callable) -> None:
+        """Run the transition by rendering the content for every step.
+        
+        Args:
+            display: Display interface to render to
+            render_func: Function that renders the incoming content
+        """
+        await display.clear()
+        await render_func()
+        await display.show()
+    
+    async def finish(self) -> None:
+        """Called after the last step; subclasses may pause here."""
+        pass
+
+
+def compose_area(source, dest, target, width: int, area: dict) -> None:
+    """Fill target with dest inside a rectangle and source outside it.
+    
+    Args:
+        source: Outgoing frame
+        dest: Incoming frame
+        target: Buffer to fill
+        width: Display width
+        area: Dictionary with x_start, x_end, y_start and y_end bounds
+    """
+    target[:] = source
+    x_start = area['x_start']
+    x_end = area['x_end']
+    if x_end <= x_start:
+        return
+    for y in range(area['y_start'], area['y_end']):
+        row = y * width
+        target[row + x_start:row + x_end] = dest[row + x_start:row + x_end]
+
+
+def _changed_pixels(target, shown, width, xs, ys, colors) -> int:
+    """Collect the target pixels that differ from what is shown.
+    
+    Updates shown to match target.
+    
+    Returns:
+        Number of changed pixels written to xs, ys and colors
+    """
+    count = 0
+    for i in range(len(target)):
+        color = target[i]
+        if color != shown[i]:
+            shown[i] = color
+            xs[count] = i % width
+            ys[count] = i // width
+            colors[count] = color
+            count += 1
+    return count
+
+
+@register_effect('cross_fade')
+class CrossFadeEffect(OffscreenTransition):
+    """Cross-fade from the outgoing content to the incoming content."""
+    
+    uses_source = True
+    
+    def __init__(self, duration: float = 1.0, steps: int = 16, **kwargs):
+        """Initialize cross-fade.
+        
+        Args:
+            duration: Fade duration in seconds
+            steps: Number of blend steps
+            **kwargs: Additional effect parameters
+        """
+        super().__init__(duration=duration, **kwargs)
+        self.steps = steps
+    
+    def get_step_count(self, width: int, height: int) -> int:
+        return self.steps
+    
+    def compose(self, source, dest, target, width: int, height: int,
+                progress: float) -> None:
+        """Mix each pixel from source toward dest by progress."""
+        # Fixed point weight so the inner loop stays in integers
+        weight = int(progress * 256)
+        for i in range(len(target)):
+            a = source[i]
+            b = dest[i]
+            if a == b:
+                target[i] = b
+                continue
+            ar = (a >> 16) & 0xFF
+            ag = (a >> 8) & 0xFF
+            ab = a & 0xFF
+            r = ar + ((((b >> 16) & 0xFF) - ar) * weight >> 8)
+            g = ag + ((((b >> 8) & 0xFF) - ag) * weight >> 8)
+            bl = ab + (((b & 0xFF) - ab) * weight >> 8)
+            target[i] = (r << 16) | (g << 8) | bl
@@ -1,8 +1,13 @@
 """Particle effects for SLDK.
 
-Simple particle systems optimized for ESP32 memory constraints.
+Pooled particle system optimized for ESP32 memory constraints.
 """
 
+import math
+from array import array
+
+from ..display.interface import draw_pixels
+
 try:
     import time
     get_time = time.monotonic
@@ -28,60 +33,250 @@ except ImportError:
     random = SimpleRandom()
 
 
+# Particle kinds held in the engine's slots (0 marks a free slot)
+KIND_FREE = 0
+KIND_SPARKLE = 1
+KIND_RAIN = 2
+KIND_EMBER = 3
+KIND_SNOW = 4
+KIND_CUSTOM = 5  # A particle object that updates and renders itself
+
+# Ember colors over its lifetime (red to yellow)
+EMBER_COLORS = (0xFF0000, 0xFF3300, 0xFF6600, 0xFF9900, 0xFFCC00, 0xFFFF00)
+
+# Seconds after which slot times are re-based so single-precision
+# floats keep their resolution
+REBASE_INTERVAL = 600.0
+
+
 class ParticleEngine:
-    """Lightweight particle engine for ESP32."""
+    """Pooled particle engine.
+    
+    Particles live in fixed-capacity slots stored as parallel arrays
+    (kind, start position, velocity, sway, birth time, lifetime, color),
+    allocated once up front. Free slots are kept on a stack, so adding
+    and expiring particles never shifts a list. Each frame one loop
+    moves every particle and collects the visible pixels into reusable
+    buffers, which are drawn with a single set_pixels() call.
+    
+    The Sparkle, RainDrop, Ember and Snow classes are spawn presets:
+    add_particle() copies their settings into a slot. Any other particle
+    object is kept in its slot and updates and renders itself.
+    """
     
     def __init__(self, max_particles=8):
         """Initialize particle engine.
         
         Args:
-            max_particles: Maximum number of particles (keep low for ESP32)
+            max_particles: Maximum number of particles (the slot capacity)
         """
         self.max_particles = max_particles
-        self.particles = []
         self.last_spawn_time = 0
+        
+        n = max_particles
+        zeros = [0.0] * n
+        self.kind = bytearray(n)
+        self.x0 = array('f', zeros)
+        self.y0 = array('f', zeros)
+        self.vx = array('f', zeros)
+        self.vy = array('f', zeros)
+        self.sway = array('f', zeros)
+        self.phase = array('f', zeros)
+        self.born = array('f', zeros)
+        self.lifetime = array('f', zeros)
+        self.color = array('L', [0] * n)
+        self._objects = [None] * n
+        self._free = list(range(n - 1, -1, -1))
+        self._epoch = get_time()
+        
+        # Pixels collected for the frame's batched write
+        self.pixel_x = array('h', [0] * n)
+        self.pixel_y = array('h', [0] * n)
+        self.pixel_color = array('L', [0] * n)
+    
+    @property
+    def particles(self):
+        """Particle objects currently in the engine."""
+        return [particle for particle in self._objects if particle is not None]
     
     def add_particle(self, particle):
         """Add particle to system.
         
         Args:
-            particle: Particle instance
+            particle: Particle instance; presets are copied into a slot
+            
+        Returns:
+            bool: True if a slot was free
         """
-        if len(self.particles) < self.max_particles:
-            particle.spawn_time = get_time()
-            self.particles.append(particle)
-            return True
-        return False
+        now = get_time()
+        particle.spawn_time = now
+        kind = _PRESET_KINDS.get(type(particle), KIND_CUSTOM)
+        if kind == KIND_CUSTOM:
+            slot = self._take_slot(kind, particle.x if hasattr(particle, 'x') else 0,
+                                   particle.y if hasattr(particle, 'y') else 0,
+                                   getattr(particle, 'lifetime', 0), now)
+        else:
+            vx, vy, sway, phase, color = particle.slot_settings()
+            slot = self._take_slot(kind, particle.start_x, particle.start_y,
+                                   particle.lifetime, now, vx, vy, sway, phase, color)
+        if slot < 0:
+            return False
+        self._objects[slot] = particle
+        return True
+    
+    def spawn(self, kind, x, y, lifetime, vx=0.0, vy=0.0, sway=0.0, phase=0.0, color=0xFFFFFF):
+        """Start a particle without creating a particle object.
+        
+        Args:
+            kind: KIND_SPARKLE, KIND_RAIN, KIND_EMBER or KIND_SNOW
+            x: Starting X position
+            y: Starting Y position
+            lifetime: Particle lifetime in seconds
+            vx: Horizontal speed in pixels per second
+            vy: Vertical speed in pixels per second (positive is down)
+            sway: Snow sway amplitude in pixels
+            phase: Snow sway phase in radians
+            color: Color as 24-bit RGB (ignored for embers and snow)
+            
+        Returns:
+            bool: True if a slot was free
+        """
+        return self._take_slot(kind, x, y, lifetime, get_time(),
+                               vx, vy, sway, phase, color) >= 0
     
     async def update(self, display):
-        """Update all particles.
+        """Update all particles and draw them.
         
         Args:
             display: Display interface
         """
-        current_time = get_time()
-        
-        # Update particles (backwards to allow removal)
-        for i in range(len(self.particles) - 1, -1, -1):
-            particle = self.particles[i]
-            elapsed = current_time - particle.spawn_time
+        now = get_time()
+        t = now - self._epoch
+        if t > REBASE_INTERVAL:
+            self._rebase(t)
+            t = 0.0
+        
+        width = display.width
+        height = display.height
+        kinds = self.kind
+        count = 0
+        
+        for i in range(self.max_particles):
+            kind = kinds[i]
+            if kind == KIND_FREE:
+                continue
+            
+            if kind == KIND_CUSTOM:
+                particle = self._objects[i]
+                elapsed = now - particle.spawn_time
+                if particle.is_dead(elapsed):
+                    self._release(i)
+                    continue
+                particle.update(elapsed)
+                await particle.render(display)
+                continue
             
-            # Remove dead particles
-            if particle.is_dead(elapsed):
-                self.particles.pop(i)
+            age = t - self.born[i]
+            lifetime = self.lifetime[i]
+            if age > lifetime:
+                self._release(i)
                 continue
             
-            # Update and render particle
-            particle.update(elapsed)
-            await particle.render(display)
+            x = self.x0[i] + self.vx[i] * age
+            y = self.y0[i] + self.vy[i] * age
+            ratio = age / lifetime if lifetime > 0 else 1.0
+            if ratio > 1.0:
+                ratio = 1.0
+            
+            if kind == KIND_SPARKLE:
+                # Peak brightness at 20% of the lifetime
+                if ratio < 0.2:
+                    color = _scale(self.color[i], ratio / 0.2)
+                else:
+                    color = _scale(self.color[i], 1.0 - (ratio - 0.2) / 0.8)
+            elif kind == KIND_EMBER:
+                if y < 0:
+                    self._release(i)
+                    continue
+                color = _scale(EMBER_COLORS[int(ratio * (len(EMBER_COLORS) - 1))], 1.0 - ratio)
+            else:
+                # Rain and snow die when they fall off the bottom
+                if y >= height:
+                    self._release(i)
+                    continue
+                if kind == KIND_SNOW:
+                    x += self.sway[i] * math.sin(age * 2 + self.phase[i])
+                color = self.color[i]
+            
+            px = int(x)
+            py = int(y)
+            if 0 <= px < width and 0 <= py < height:
+                self.pixel_x[count] = px
+                self.pixel_y[count] = py
+                self.pixel_color[count] = color
+                count += 1
+        
+        if count:
+            await draw_pixels(display, self.pixel_x, self.pixel_y, self.pixel_color, count)
     
     def clear_particles(self):
         """Remove all particles."""
-        self.particles.clear()
+        for i in range(self.max_particles):
+            self.kind[i] = KIND_FREE
+            self._objects[i] = None
+        self._free = list(range(self.max_particles - 1, -1, -1))
     
     def get_particle_count(self):
         """Get current particle count."""
-        return len(self.particles)
+        return self.max_particles - len(self._free)
+    
+    def _take_slot(self, kind, x, y, lifetime, now, vx=0.0, vy=0.0, sway=0.0, phase=0.0, color=0):
+        """Fill a free slot.
+        
+        Returns:
+            int: The slot index, or -1 if the engine is full
+        """
+        if not self._free:
+            return -1
+        if len(self._free) == self.max_particles:
+            # Empty engine: restart the time base while it's free to do so
+            self._epoch = now
+        slot = self._free.pop()
+        self.kind[slot] = kind
+        self.x0[slot] = x
+        self.y0[slot] = y
+        self.vx[slot] = vx
+        self.vy[slot] = vy
+        self.sway[slot] = sway
+        self.phase[slot] = phase
+        self.born[slot] = now - self._epoch
+        self.lifetime[slot] = lifetime
+        self.color[slot] = color
+        return slot
+    
+    def _release(self, slot):
+        """Return a slot to the free list."""
+        self.kind[slot] = KIND_FREE
+        self._objects[slot] = None
+        self._free.append(slot)
+    
+    def _rebase(self, t):
+        """Move the time base forward by t seconds."""
+        self._epoch += t
+        for i in range(self.max_particles):
+            self.born[i] -= t
+
+
+def _scale(color, brightness):
+    """Scale a 24-bit RGB color by a brightness between 0.0 and 1.0."""
+    if brightness <= 0.0:
+        return 0
+    if brightness > 1.0:
+        brightness = 1.0
+    r = int(((color >> 16) & 0xFF) * brightness)
+    g = int(((color >> 8) & 0xFF) * brightness)
+    b = int((color & 0xFF) * brightness)
+    return (r << 16) | (g << 8) | b
 
 
 class Particle:
@@ -129,6 +324,14 @@ class Particle:
         """
         return elapsed_time > self.lifetime
     
+    def slot_settings(self):
+        """Get the settings a preset copies into an engine slot.
+        
+        Returns:
+            tuple: (vx, vy, sway, phase, color)
+        """
+        return 0.0, 0.0, 0.0, 0.0, 0xFFFFFF
+    
     def get_life_ratio(self, elapsed_time):
         """Get life ratio (0.0 = just born, 1.0 = about to die).
         
@@ -157,6 +360,10 @@ class Sparkle(Particle):
         self.color = color
         self.peak_time = lifetime * 0.2  # Peak brightness at 20% of lifetime
     
+    def slot_settings(self):
+        """Sparkles stay put."""
+        return 0.0, 0.0, 0.0, 0.0, self.color
+    
     async def render(self, display):
         """Render sparkle with fading."""
         # Check bounds
@@ -204,6 +411,10 @@ class RainDrop(Particle):
         self.speed = speed
         self.color = color
     
+    def slot_settings(self):
+        """Rain falls straight down."""
+        return 0.0, self.speed, 0.0, 0.0, self.color
+    
     def update(self, elapsed_time):
         """Update rain drop physics."""
         # Move down
@@ -244,7 +455,11 @@ class Ember(Particle):
         self.drift_direction = 1 if random.random() > 0.5 else -1
         
         # Ember colors (red to yellow to white)
-        self.colors = [0xFF0000, 0xFF3300, 0xFF6600, 0xFF9900, 0xFFCC00, 0xFFFF00]
+        self.colors = list(EMBER_COLORS)
+    
+    def slot_settings(self):
+        """Embers rise and drift to one side."""
+        return self.drift * self.drift_direction, -self.speed, 0.0, 0.0, 0
     
     def update(self, elapsed_time):
         """Update ember physics."""
@@ -302,13 +517,16 @@ class Snow(Particle):
         self.sway = sway
         self.sway_phase = random.random() * 6.28  # Random phase for sway
     
+    def slot_settings(self):
+        """Snow falls white and sways."""
+        return 0.0, self.speed, self.sway, self.sway_phase, 0xFFFFFF
+    
     def update(self, elapsed_time):
         """Update snow physics."""
         # Fall down
         self.y = self.start_y + (self.speed * elapsed_time)
         
         # Sway side to side
-        import math
         sway_offset = self.sway * math.sin(elapsed_time * 2 + self.sway_phase)
         self.x = self.start_x + sway_offset
     
@@ -325,4 +543,13 @@ class Snow(Particle):
     
     def is_dead(self, elapsed_time):
         """Snow dies when it falls off screen."""
-        return (self.y >= 32) or super().is_dead(elapsed_time)
\ No newline at end of file
+        return (self.y >= 32) or super().is_dead(elapsed_time)
+
+
+# Preset classes the engine runs from its slots
+_PRESET_KINDS = {
+    Sparkle: KIND_SPARKLE,
+    RainDrop: KIND_RAIN,
+    Ember: KIND_EMBER,
+    Snow: KIND_SNOW,
+}
@@ -7,6 +7,8 @@ it from one side to the other, similar to wiping away a cover.
 import time
 from typing import Callable
 from .base import Effect, register_effect
+from .offscreen import OffscreenTransition, compose_area
+from ..display.timeline import play_steps
 
 try:
     # CircuitPython compatibility
@@ -16,12 +18,13 @@ except ImportError:
 
 
 @register_effect('reveal')
-class RevealEffect(Effect):
+class RevealEffect(OffscreenTransition):
     """Reveal effect that gradually unveils content.
     
     The reveal effect shows content progressively from one side to another,
     creating a dramatic unveiling animation. This is particularly effective
-    for splash screens and important messages.
+    for splash screens and important messages. The content is rendered
+    once and each step uncovers more of the captured frame.
     """
     
     def __init__(self, 
@@ -48,15 +51,37 @@ class RevealEffect(Effect):
         self.steps = steps
         self.pause_at_end = pause_at_end
     
-    async def apply(self, display, render_func: Callable) -> None:
-        """Apply the reveal effect.
+    def get_step_count(self, width: int, height: int) -> int:
+        """Get the number of reveal steps, one per pixel unless set."""
+        if self.steps is not None:
+            return self.steps
+        return width if self.direction in ['left', 'right'] else height
+    
+    def get_transition_duration(self) -> float:
+        return self.reveal_duration
+    
+    def compose(self, source, dest, target, width: int, height: int,
+                progress: float) -> None:
+        """Show the captured content inside the revealed area."""
+        steps = self.get_step_count(width, height)
+        area = self._calculate_reveal_area(width, height, round(progress * steps), steps)
+        compose_area(source, dest, target, width, area)
+    
+    async def finish(self) -> None:
+        """Pause with the full content displayed."""
+        if self.pause_at_end > 0:
+            if asyncio:
+                await asyncio.sleep(self.pause_at_end)
+            else:
+                time.sleep(self.pause_at_end)
+    
+    async def apply_live(self, display, render_func: Callable) -> None:
+        """Apply the reveal effect by rendering the content for every step.
         
         Args:
             display: Display interface to render to
             render_func: Function that renders the base content
         """
-        start_time = time.time()
-        
         # Get display dimensions
         width = getattr(display, 'width', 64)
         height = getattr(display, 'height', 32)
@@ -68,15 +93,9 @@ class RevealEffect(Effect):
             else:  # up, down
                 self.steps = height
         
-        # Pre-render the content to a buffer if possible
-        # For now, we'll render on-demand for each step
-        
-        # Perform reveal animation
-        step_duration = self.reveal_duration / self.steps
-        
-        for step in range(self.steps + 1):  # +1 to include final complete state
+        async def draw(step):
             # Calculate reveal area based on direction and step
-            reveal_area = self._calculate_reveal_area(width, height, step)
+            reveal_area = self._calculate_reveal_area(width, height, step, self.steps)
             
             # Clear display
             await display.clear()
@@ -86,13 +105,10 @@ class RevealEffect(Effect):
             
             # Update display
             await display.show()
-            
-            # Wait for next step (except on last step)
-            if step < self.steps:
-                if asyncio:
-                    await asyncio.sleep(step_duration)
-                else:
-                    time.sleep(step_duration)
+        
+        # Perform reveal animation, from nothing to the final complete state
+        await play_steps(self.steps, self.reveal_duration, draw,
+                         easing=self.params.get('easing', 'linear'))
         
         # Pause at end with full content displayed
         if self.pause_at_end > 0:
@@ -101,18 +117,20 @@ class RevealEffect(Effect):
             else:
                 time.sleep(self.pause_at_end)
     
-    def _calculate_reveal_area(self, width: int, height: int, step: int) -> dict:
+    def _calculate_reveal_area(self, width: int, height: int, step: int,
+                               total_steps: int) -> dict:
         """Calculate the reveal area for the given step.
         
         Args:
             width: Display width
             height: Display height
-            step: Current step (0 to self.steps)
+            step: Current step (0 to total_steps)
+            total_steps: Number of reveal steps
             
         Returns:
             Dictionary with reveal area bounds
         """
-        progress = step / self.steps if self.steps > 0 else 1.0
+        progress = step / total_steps if total_steps > 0 else 1.0
         
         if self.direction == 'right':
             # Reveal from left to right
@@ -10,6 +10,8 @@ except (ImportError, AttributeError):
     import time
     get_time = time.time
 
+from ..display.timeline import get_easing
+
 
 class TransitionEngine:
     """Engine for managing content transitions."""
@@ -252,7 +254,8 @@ class SlideTransition(BaseTransition):
         Args:
             duration: Transition duration
             direction: Slide direction ("left", "right", "up", "down")
-            easing: Easing function ("linear", "ease_out")
+            easing: Easing name from sldk.display.timeline.EASINGS
+                ("linear", "ease_out", ...) or an easing function
         """
         super().__init__(duration)
         self.direction = direction
@@ -267,12 +270,7 @@ class SlideTransition(BaseTransition):
         Returns:
             float: Eased progress
         """
-        if self.easing == "ease_out":
-            # Simple ease-out: 1 - (1-t)^2
-            return 1 - (1 - progress) ** 2
-        else:
-            # Linear
-            return progress
+        return get_easing(self.easing)(progress)
     
     async def update(self, display, progress):
         """Update slide transition."""
@@ -3,6 +3,7 @@
 import os
 from ..displayio import Bitmap, Palette
 from .glyph_cache import GlyphCache
+from .glyph_atlas import GlyphAtlas
 
 
 class BitmapFont:
@@ -27,6 +28,7 @@ class BitmapFont:
         self.glyphs = {}
         self.default_char = ord('?')
         self._glyph_cache = GlyphCache()
+        self._atlas = None
         
     def load_font(self, filename):
         """Load a BDF font file.
@@ -36,6 +38,7 @@ class BitmapFont:
         """
         self.glyphs.clear()
         self._glyph_cache.clear()
+        self._atlas = None
         
         with open(filename, 'r', encoding='latin-1') as f:
             self._parse_bdf(f)
@@ -152,78 +155,48 @@ class BitmapFont:
         if cached:
             return cached
             
-        # Get glyph data
-        if char_code not in self.glyphs:
-            # Use default character
-            char_code = self.default_char
-            if char_code not in self.glyphs:
-                return None
-                
-        glyph_data = self.glyphs[char_code]
-        
-        # Create bitmap for glyph
-        width = glyph_data['width']
-        height = glyph_data['height']
-        
-        if width == 0 or height == 0:
-            # Handle zero-size glyphs (like spaces) - they still need DWIDTH for advancement
-            result = {
-                'bitmap': None,  # No bitmap to render
-                'width': width,
-                'height': height,
-                'dx': glyph_data['dwidth'],  # Still use DWIDTH for spacing
-                'dy': 0,
-                'x_offset': glyph_data['x_offset'],
-                'y_offset': glyph_data['y_offset']
-            }
-            # Cache the result
-            self._glyph_cache.put(char_code, None, result)
-            return result
+        atlas = self.atlas
+        index = atlas.index(char_code)
+        if index < 0:
+            return None
             
-        # Create bitmap with 2 colors (0=background, 1=foreground)
-        bitmap = Bitmap(width, height, 2)
-        
-        # Parse hex bitmap data
-        for y, hex_line in enumerate(glyph_data['bitmap']):
-            if y >= height:
-                break
-                
-            # Convert hex to binary
-            byte_width = (width + 7) // 8
-            hex_line = hex_line.ljust(byte_width * 2, '0')
+        width = int(atlas.width[index])
+        height = int(atlas.height[index])
+        
+        # Zero-size glyphs (like spaces) have no bitmap but still advance
+        bitmap = None
+        if width and height:
+            # Glyph bitmaps share the atlas pixels instead of copying them
+            bitmap = Bitmap(width, height, 2)
+            bitmap._buffer = atlas.glyph_pixels(index)
             
-            for byte_idx in range(0, len(hex_line), 2):
-                if byte_idx // 2 >= byte_width:
-                    break
-                    
-                byte_val = int(hex_line[byte_idx:byte_idx + 2], 16)
-                
-                for bit in range(8):
-                    x = (byte_idx // 2) * 8 + bit
-                    if x >= width:
-                        break
-                        
-                    if byte_val & (0x80 >> bit):
-                        bitmap[x, y] = 1
-                    else:
-                        bitmap[x, y] = 0
-                        
-        # Create result dictionary
         result = {
             'bitmap': bitmap,
             'width': width,
             'height': height,
-            'dx': glyph_data['dwidth'],  # Use DWIDTH for proper kerning/spacing
+            'dx': int(atlas.dx[index]),  # Use DWIDTH for proper kerning/spacing
             'dy': 0,
-            'x_offset': glyph_data['x_offset'],
-            'y_offset': glyph_data['y_offset']
+            'x_offset': int(atlas.x_offset[index]),
+            'y_offset': int(atlas.y_offset[index])
         }
         
-        # Cache the result
+        # Cache under the requested code so missing characters resolve
+        # to the default glyph only once
         self._glyph_cache.put(char_code, bitmap, result)
         
         return result
         
+    @property
+    def atlas(self):
+        """Packed glyph atlas for this font, built on first use.
+        
+        Returns:
+            GlyphAtlas with every glyph decoded into one numpy bitmap
+        """
+        if self._atlas is None:
+            self._atlas = GlyphAtlas(self.glyphs, self.default_char)
+        return self._atlas
+        
     def get_bounding_box(self):
         """Get font bounding box.
         
@@ -0,0 +1,217 @@
+"""Packed glyph atlas for bitmap fonts."""
+
+from collections import OrderedDict
+
+import numpy as np
+
+
+class ShapedRun:
+    """A line of text laid out and rasterized into one mask.
+    
+    Coordinates are relative to the pen start on the baseline: the mask's
+    top-left pixel sits at (left, top), and the pen ends at advance.
+    """
+    
+    __slots__ = ('mask', 'left', 'top', 'advance')
+    
+    def __init__(self, mask, left, top, advance):
+        """Initialize shaped run.
+        
+        Args:
+            mask: Read-only (rows, cols) uint8 array with 1 for set pixels
+            left: Column of the mask's left edge relative to the pen start
+            top: Row of the mask's top edge relative to the baseline
+            advance: Total advance width of the run
+        """
+        self.mask = mask
+        self.left = left
+        self.top = top
+        self.advance = advance
+
+
+class GlyphAtlas:
+    """All glyphs of a font decoded once into a single numpy bitmap.
+    
+    Glyphs are packed left to right into one strip as tall as the
+    tallest glyph. A metrics table indexed by glyph number gives each
+    glyph's strip position, size, offsets and advance, so rendering
+    text is a series of slice copies out of ``pixels``. Shaped lines
+    are kept in a small LRU so repeated strings cost one lookup.
+    """
+    
+    # Number of shaped runs kept per font
+    MAX_RUNS = 128
+    
+    def __init__(self, glyphs, default_char=ord('?')):
+        """Build the atlas.
+        
+        Args:
+            glyphs: BitmapFont.glyphs mapping of char code to BDF data
+            default_char: Code used for characters missing from the font
+        """
+        self.codes = sorted(glyphs)
+        self._index = {code: i for i, code in enumerate(self.codes)}
+        
+        count = len(self.codes)
+        self.atlas_x = np.zeros(count, dtype=np.int32)
+        self.width = np.zeros(count, dtype=np.int32)
+        self.height = np.zeros(count, dtype=np.int32)
+        self.x_offset = np.zeros(count, dtype=np.int32)
+        self.y_offset = np.zeros(count, dtype=np.int32)
+        self.dx = np.zeros(count, dtype=np.int32)
+        
+        x = 0
+        for i, code in enumerate(self.codes):
+            glyph = glyphs[code]
+            self.atlas_x[i] = x
+            self.width[i] = glyph['width']
+            self.height[i] = glyph['height']
+            self.x_offset[i] = glyph['x_offset']
+            self.y_offset[i] = glyph['y_offset']
+            self.dx[i] = glyph['dwidth']
+            x += glyph['width']
+        
+        strip_height = int(self.height.max()) if count else 0
+        self.pixels = np.zeros((strip_height, x), dtype=np.uint8)
+        for i, code in enumerate(self.codes):
+            width = int(self.width[i])
+            height = int(self.height[i])
+            if width and height:
+                left = int(self.atlas_x[i])
+                self.pixels[:height, left:left + width] = _decode_rows(
+                    glyphs[code]['bitmap'], width, height)
+        # Glyph views hand out slices of this array; keep it immutable
+        self.pixels.flags.writeable = False
+        
+        self.default_index = self._index.get(default_char, -1)
+        self._runs = OrderedDict()
+        
+    def __len__(self):
+        return len(self.codes)
+        
+    def index(self, char):
+        """Glyph number for a character.
+        
+        Args:
+            char: Character or character code
+        
+        Returns:
+            Index into the metrics arrays, the default glyph's index for
+            missing characters, or -1 if neither exists
+        """
+        code = ord(char) if isinstance(char, str) else char
+        return self._index.get(code, self.default_index)
+        
+    def glyph_pixels(self, index):
+        """Read-only (height, width) view of one glyph.
+        
+        Args:
+            index: Glyph number from index()
+        
+        Returns:
+            Numpy uint8 array with 1 for set pixels
+        """
+        left = int(self.atlas_x[index])
+        return self.pixels[:int(self.height[index]), left:left + int(self.width[index])]
+        
+    def blit(self, target, index, x, y):
+        """OR a glyph into a target array with clipping.
+        
+        Args:
+            target: 2D numpy array (rows, cols) to draw into
+            index: Glyph number from index()
+            x: Target column of the glyph's left edge
+            y: Target row of the glyph's top edge
+        """
+        blit_mask(target, self.glyph_pixels(index), x, y)
+        
+    def shape(self, text):
+        """Lay out and rasterize one line of text.
+        
+        Measuring and drawing happen in the same pass: advances come
+        from a cumulative sum over the metrics table, then each glyph
+        is OR-ed into the run mask with a slice copy.
+        
+        Args:
+            text: Single line of text
+            
+        Returns:
+            ShapedRun (cached; treat as read-only)
+        """
+        run = self._runs.get(text)
+        if run is not None:
+            self._runs.move_to_end(text)
+            return run
+            
+        indices = [self.index(char) for char in text]
+        glyphs = np.array([i for i in indices if i >= 0], dtype=np.intp)
+        
+        advances = self.dx[glyphs]
+        advance = int(advances.sum())
+        pen = np.cumsum(advances) - advances
+        glyph_x = pen + self.x_offset[glyphs]
+        glyph_y = -self.height[glyphs] - self.y_offset[glyphs]
+        widths = self.width[glyphs]
+        heights = self.height[glyphs]
+        
+        # Only glyphs with pixels contribute to the mask bounds
+        inked = (widths > 0) & (heights > 0)
+        if inked.any():
+            left = min(0, int(glyph_x[inked].min()))
+            right = max(advance, int((glyph_x + widths)[inked].max()))
+            top = int(glyph_y[inked].min())
+            bottom = int((glyph_y + heights)[inked].max())
+        else:
+            left, right, top, bottom = 0, advance, 0, 0
+            
+        mask = np.zeros((bottom - top, right - left), dtype=np.uint8)
+        for i in np.flatnonzero(inked):
+            blit_mask(mask, self.glyph_pixels(glyphs[i]),
+                      int(glyph_x[i]) - left, int(glyph_y[i]) - top)
+        mask.flags.writeable = False
+        
+        run = ShapedRun(mask, left, top, advance)
+        self._runs[text] = run
+        if len(self._runs) > self.MAX_RUNS:
+            self._runs.popitem(last=False)
+        return run
+
+
+def blit_mask(target, mask, x, y):
+    """OR a 0/1 mask into a target array, clipped to the target.
+    
+    Args:
+        target: 2D numpy array (rows, cols)
+        mask: 2D numpy array of 0/1 values
+        x: Target column of the mask's left edge
+        y: Target row of the mask's top edge
+    """
+    rows, cols = target.shape
+    height, width = mask.shape
+    x1, y1 = max(x, 0), max(y, 0)
+    x2, y2 = min(x + width, cols), min(y + height, rows)
+    if x1 >= x2 or y1 >= y2:
+        return
+    region = target[y1:y2, x1:x2]
+    np.bitwise_or(region, mask[y1 - y:y2 - y, x1 - x:x2 - x], out=region)
+
+
+def _decode_rows(hex_rows, width, height):
+    """Decode BDF hex bitmap rows into a (height, width) 0/1 array.
+    
+    Args:
+        hex_rows: List of hex strings, one per row
+        width: Glyph width in pixels
+        height: Glyph height in pixels
+    
+    Returns:
+        Numpy uint8 array
+    """
+    byte_width = (width + 7) // 8
+    row_chars = byte_width * 2
+    rows = [row.ljust(row_chars, '0')[:row_chars] for row in hex_rows[:height]]
+    # Missing rows are blank
+    rows.extend(['0' * row_chars] * (height - len(rows)))
+    data = np.frombuffer(bytes.fromhex(''.join(rows)), dtype=np.uint8)
+    bits = np.unpackbits(data).reshape(height, byte_width * 8)
+    return bits[:, :width]
@@ -1,12 +1,14 @@
 """Glyph caching for bitmap fonts."""
 
-from ..displayio import Bitmap
+from collections import OrderedDict
 
 
 class GlyphCache:
     """Cache for rendered font glyphs.
     
     Stores pre-rendered glyphs to improve text rendering performance.
+    Least recently used glyphs are evicted first; lookups, inserts and
+    evictions are all O(1).
     """
     
     def __init__(self, max_glyphs=256):
@@ -16,24 +18,23 @@ class GlyphCache:
             max_glyphs: Maximum number of glyphs to cache
         """
         self.max_glyphs = max_glyphs
-        self._cache = {}
-        self._access_order = []
+        # Ordered oldest to most recently used
+        self._cache = OrderedDict()
         
     def get(self, char_code):
         """Get a cached glyph.
         
         Args:
             char_code: Character code to get
-            
+        
         Returns:
             Cached glyph info dictionary or None if not cached
         """
-        if char_code in self._cache:
-            # Move to end of access order (most recently used)
-            self._access_order.remove(char_code)
-            self._access_order.append(char_code)
-            return self._cache[char_code]['info']
-        return None
+        entry = self._cache.get(char_code)
+        if entry is None:
+            return None
+        self._cache.move_to_end(char_code)
+        return entry['info']
         
     def put(self, char_code, glyph_bitmap, glyph_info):
         """Add a glyph to the cache.
@@ -43,28 +44,21 @@ class GlyphCache:
             glyph_bitmap: Bitmap containing glyph pixels
             glyph_info: Dictionary with glyph metrics
         """
-        # Check if we need to evict old glyphs
-        if len(self._cache) >= self.max_glyphs and char_code not in self._cache:
+        if char_code in self._cache:
+            self._cache.move_to_end(char_code)
+        elif len(self._cache) >= self.max_glyphs:
             # Evict least recently used
-            old_char = self._access_order.pop(0)
-            del self._cache[old_char]
-            
-        # Add to cache
+            self._cache.popitem(last=False)
+        
         self._cache[char_code] = {
             'bitmap': glyph_bitmap,
             'info': glyph_info
         }
         
-        # Update access order
-        if char_code in self._access_order:
-            self._access_order.remove(char_code)
-        self._access_order.append(char_code)
-        
     def clear(self):
         """Clear all cached glyphs."""
         self._cache.clear()
-        self._access_order.clear()
         
     def __len__(self):
         """Get number of cached glyphs."""
-        return len(self._cache)
\ No newline at end of file
+        return len(self._cache)
@@ -2,6 +2,7 @@
 
 from ..displayio import Group, Bitmap, Palette, TileGrid
 from ..core.color_utils import rgb888_to_rgb565
+from ..adafruit_bitmap_font.glyph_atlas import blit_mask
 
 
 class Label(Group):
@@ -68,6 +69,9 @@ class Label(Group):
         self._bitmap = None
         self._palette = None
         self._tilegrid = None
+        # Size the text needs; the bitmap may be larger when reused
+        self._text_width = 0
+        self._text_height = 0
         
         # Set initial text
         if text:
@@ -126,12 +130,10 @@ class Label(Group):
             new_color: New color value or None for transparent
         """
         self._background_color = new_color
-        if self._palette and new_color is not None:
-            if isinstance(new_color, int):
-                self._palette[0] = new_color
-            else:
-                self._palette[0] = rgb888_to_rgb565(*new_color)
-        self._update_text()
+        if self._palette:
+            self._update_palette()
+        if self._bitmap:
+            self._update_text()
         
     @property
     def anchor_point(self):
@@ -164,117 +166,89 @@ class Label(Group):
         self._update_position()
         
     def _update_text(self):
-        """Update the text bitmap and display objects."""
+        """Update the text bitmap and display objects.
+        
+        Each line is shaped once by the font atlas (cached for repeated
+        strings) and OR-ed into the label bitmap with a slice copy. The
+        bitmap, palette and tilegrid are reused whenever the text fits.
+        """
         # Replace tabs
         display_text = self._text
         if '\t' in display_text:
             tab_spaces, tab_char = self.tab_replacement
             display_text = display_text.replace('\t', tab_char * tab_spaces)
             
-        # Calculate text dimensions
         lines = display_text.split('\n')
-        max_width = 0
-        total_height = 0
-        
-        for i, line in enumerate(lines):
-            line_width = 0
-            line_height = 0
-            char_count = 0
+        if self.label_direction == "RTL":
+            lines = [line[::-1] for line in lines]
             
-            for char in line:
-                glyph = self.font.get_glyph(char)
-                if glyph:
-                    line_width += glyph['dx']
-                    line_height = max(line_height, glyph['height'])
-                    char_count += 1
-                    
-            # Character spacing is now handled by DWIDTH from BDF file
-                    
-            max_width = max(max_width, line_width)
-            if i == 0:
-                total_height = self.font.height  # Use font height, not glyph height
-            else:
-                total_height += int(self.font.height * self.line_spacing)
-                
+        # Measure and rasterize in the same pass
+        atlas = self.font.atlas
+        runs = [atlas.shape(line) for line in lines]
+        max_width = max(run.advance for run in runs)
+        line_step = int(self.font.height * self.line_spacing)
+        
         # Add padding
         bitmap_width = max_width + self.padding_left + self.padding_right
         # Calculate bitmap height for proper baseline alignment
         # Need space for: padding_top + font.ascent (above baseline) + font.descent (below baseline) + padding_bottom
         # For multiline text, add space for additional lines
         bitmap_height = self.padding_top + self.font.ascent + self.padding_bottom
-        if len(lines) > 1:
-            # Add space for additional lines
-            bitmap_height += (len(lines) - 1) * int(self.font.height * self.line_spacing)
+        bitmap_height += (len(lines) - 1) * line_step
         # Add space for descenders (font.descent is the maximum depth below baseline)
         bitmap_height += self.font.descent
         
         # Ensure minimum size
         bitmap_width = max(1, bitmap_width)
         bitmap_height = max(1, bitmap_height)
+        self._text_width = bitmap_width
+        self._text_height = bitmap_height
         
-        # Create new bitmap and palette
-        self._bitmap = Bitmap(bitmap_width, bitmap_height, 2)
-        self._palette = Palette(2)
-        
-        # Set colors
-        if self._background_color is None:
-            self._palette.make_transparent(0)
+        if self._palette is None:
+            self._palette = Palette(2)
+            self._update_palette()
+            
+        # A transparent label can draw into a larger bitmap than it needs;
+        # with a background the bitmap has to match exactly
+        if self._bitmap_fits(bitmap_width, bitmap_height):
+            self._bitmap._buffer.fill(0)
         else:
-            self._palette[0] = self._background_color
-        self._palette[1] = self._color
-        
-        # Fill background
-        if self._background_color is not None:
-            self._bitmap.fill(0)
+            self._bitmap = Bitmap(bitmap_width, bitmap_height, 2)
+            self._replace_tilegrid()
             
-        # Render text with proper baseline alignment
         # The baseline should be positioned font.ascent pixels from the top of the text area
         # This leaves room for ascenders above and descenders below the baseline
         baseline_y = self.padding_top + self.font.ascent
+        text_pixels = self._bitmap._buffer
+        for run in runs:
+            blit_mask(text_pixels, run.mask,
+                      self.padding_left + run.left, baseline_y + run.top)
+            baseline_y += line_step
+            
+        # Pixels were written directly into the buffer
+        self._bitmap.dirty()
         
-        for line_num, line in enumerate(lines):
-            x_offset = self.padding_left
+        # Update position if anchored
+        self._update_position()
+        
+    def _bitmap_fits(self, width, height):
+        """Check whether the current bitmap can hold the new text.
+        
+        Args:
+            width: Needed width in pixels
+            height: Needed height in pixels
             
-            # Handle RTL text direction
-            if self.label_direction == "RTL":
-                line = line[::-1]
-                
-            for char in line:
-                glyph = self.font.get_glyph(char)
-                if not glyph:
-                    continue
-                    
-                # Get glyph bitmap
-                glyph_bitmap = glyph['bitmap']
-                glyph_x_offset = glyph.get('x_offset', 0)
-                glyph_y_offset = glyph.get('y_offset', 0)
-                
-                # Calculate position with proper baseline alignment
-                # All characters are positioned relative to the common baseline
-                draw_x = x_offset + glyph_x_offset
-                # Position character so its bottom edge aligns with baseline + y_offset
-                # For y_offset=0: character bottom is at baseline
-                # For y_offset=-2: character bottom is 2 pixels below baseline (descender)
-                draw_y = baseline_y - glyph['height'] - glyph_y_offset
-                
-                # Copy glyph pixels to main bitmap (skip if no bitmap, e.g., spaces)
-                if glyph_bitmap is not None:
-                    for gy in range(glyph_bitmap.height):
-                        for gx in range(glyph_bitmap.width):
-                            if glyph_bitmap[gx, gy] > 0:
-                                bx = draw_x + gx
-                                by = draw_y + gy
-                                if 0 <= bx < bitmap_width and 0 <= by < bitmap_height:
-                                    self._bitmap[bx, by] = 1
-                                
-                # Use DWIDTH from BDF file for proper kerning
-                x_offset += glyph['dx']
-                
-            # Move to next line
-            if line_num < len(lines) - 1:
-                baseline_y += int(self.font.height * self.line_spacing)
-                
-        # Update or create tilegrid
+        Returns:
+            True if the bitmap can be cleared and reused
+        """
+        if self._bitmap is None:
+            return False
+        if self._background_color is None:
+            return self._bitmap.width >= width and self._bitmap.height >= height
+        return self._bitmap.width == width and self._bitmap.height == height
+        
+    def _replace_tilegrid(self):
+        """Show the current bitmap through a new tilegrid."""
         if self._tilegrid:
             self.remove(self._tilegrid)
             
@@ -292,8 +266,14 @@ class Label(Group):
         
         self.append(self._tilegrid)
         
-        # Update position if anchored
-        self._update_position()
+    def _update_palette(self):
+        """Apply the text and background colors to the palette."""
+        if self._background_color is None:
+            self._palette.make_transparent(0)
+        else:
+            self._palette.make_opaque(0)
+            self._palette[0] = self._background_color
+        self._palette[1] = self._color
         
     def _update_position(self):
         """Update position based on anchor point."""
@@ -302,8 +282,8 @@ class Label(Group):
             pos_x, pos_y = self._anchored_position
             
             # Calculate actual position
-            self.x = int(pos_x - self._bitmap.width * anchor_x)
-            self.y = int(pos_y - self._bitmap.height * anchor_y)
+            self.x = int(pos_x - self._text_width * anchor_x)
+            self.y = int(pos_y - self._text_height * anchor_y)
             
     @property
     def bounding_box(self):
@@ -312,17 +292,15 @@ class Label(Group):
         Returns:
             Tuple of (x, y, width, height)
         """
-        if self._bitmap:
-            return (self.x, self.y, self._bitmap.width, self._bitmap.height)
-        return (self.x, self.y, 0, 0)
+        return (self.x, self.y, self._text_width, self._text_height)
         
     @property
     def width(self):
         """Get the width of the label."""
-        return self._bitmap.width if self._bitmap else 0
+        return self._text_width
         
     @property
     def height(self):
         """Get the height of the label."""
-        return self._bitmap.height if self._bitmap else 0
+        return self._text_height
     
@@ -1,6 +1,10 @@
 """Scrolling text label implementation."""
 
 import time
+
+import numpy as np
+
+from ..displayio import Bitmap, Palette
 from .label import Label
 
 
@@ -8,6 +12,12 @@ class ScrollingLabel(Label):
     """A label that can scroll text horizontally.
     
     Compatible with CircuitPython's adafruit_display_text.scrolling_label.ScrollingLabel API.
+    
+    The full text is rasterized once into a strip as wide as its advance.
+    Every scroll step copies a window out of that strip (wrapping at the
+    end), so scrolling never reshapes or re-rasterizes text. With a
+    ``speed`` the window moves by pixels on a fixed timestep instead of
+    by whole characters.
     """
     
     def __init__(self, font, *, text="", max_characters=None, color=0xFFFFFF,
@@ -15,7 +25,8 @@ class ScrollingLabel(Label):
                  padding_top=0, padding_bottom=0, padding_left=0, padding_right=0,
                  anchor_point=None, anchored_position=None, scale=1,
                  base_alignment=False, tab_replacement=(4, " "), label_direction="LTR",
-                 animate_time=0.3, current_index=0, **kwargs):
+                 animate_time=0.3, current_index=0, speed=None,
+                 frame_rate=60, max_catchup=0.25, **kwargs):
         """Initialize ScrollingLabel.
         
         Args:
@@ -38,6 +49,11 @@ class ScrollingLabel(Label):
             label_direction: Text direction ("LTR" or "RTL")
             animate_time: Time in seconds between scroll steps
             current_index: Starting index in the text
+            speed: Smooth scroll speed in pixels per second (may be
+                fractional); None steps one character per animate_time
+            frame_rate: Fixed timestep rate for smooth scrolling
+            max_catchup: Longest stall in seconds that smooth scrolling
+                catches up on; longer stalls resume without jumping
             **kwargs: Additional keyword arguments
         """
         self._full_text = str(text)
@@ -46,12 +62,12 @@ class ScrollingLabel(Label):
         self.current_index = current_index
         self._last_animate_time = 0
         self._is_scrolling = False
-        
-        # Initialize with visible portion of text
-        visible_text = self._get_visible_text()
+        self.speed = speed
+        self.frame_rate = frame_rate
+        self.max_catchup = max_catchup
         
         super().__init__(
-            font, text=visible_text, color=color, background_color=background_color,
+            font, text="", color=color, background_color=background_color,
             line_spacing=line_spacing, background_tight=background_tight,
             padding_top=padding_top, padding_bottom=padding_bottom,
             padding_left=padding_left, padding_right=padding_right,
@@ -61,6 +77,17 @@ class ScrollingLabel(Label):
             **kwargs
         )
         
+        # Pre-rendered strip of the full text and the scroll position in it
+        self._strip = None
+        self._char_x = None
+        self._window_width = 0
+        self._offset = 0.0
+        self._drawn_offset = None
+        self._accumulator = 0.0
+        
+        # Initialize with visible portion of text
+        self._update_visible_text()
+        
     @property
     def full_text(self):
         """Get the full text string."""
@@ -75,6 +102,8 @@ class ScrollingLabel(Label):
         """
         self._full_text = str(new_text)
         self.current_index = 0
+        self._offset = 0.0
+        self._strip = None
         self._update_visible_text()
         
     def _get_visible_text(self):
@@ -88,17 +117,92 @@ class ScrollingLabel(Label):
             return self._full_text
             
         # Get visible portion with wrapping
-        visible = ""
-        for i in range(self.max_characters):
-            char_index = (self.current_index + i) % text_len
-            visible += self._full_text[char_index]
-            
-        return visible
+        start = self.current_index % text_len
+        doubled = self._full_text + self._full_text
+        return doubled[start:start + self.max_characters]
         
     def _update_visible_text(self):
         """Update the displayed text to show current visible portion."""
-        visible_text = self._get_visible_text()
-        super(ScrollingLabel, self.__class__).text.fset(self, visible_text)
+        if len(self._full_text) <= self.max_characters:
+            # Fits without scrolling; draw it as a plain label
+            self._strip = None
+            self._drawn_offset = None
+            self._text = None
+            super(ScrollingLabel, self.__class__).text.fset(self, self._full_text)
+            return
+            
+        if self._strip is None:
+            self._build_strip()
+        # Character-wise positioning snaps the window to a glyph boundary
+        self._offset = float(self._char_x[self.current_index % len(self._char_x)])
+        self._text = self._get_visible_text()
+        self._render_window()
+        
+    def _update_text(self):
+        """Redraw the label, from the strip while scrolling."""
+        if self._strip is None:
+            super()._update_text()
+            return
+        self._drawn_offset = None
+        self._render_window()
+        
+    def _build_strip(self):
+        """Rasterize the full text once into a wrapping strip."""
+        atlas = self.font.atlas
+        text = self._full_text
+        if '\t' in text:
+            tab_spaces, tab_char = self.tab_replacement
+            text = text.replace('\t', tab_char * tab_spaces)
+            
+        run = atlas.shape(text)
+        indices = np.array([atlas.index(char) for char in text], dtype=np.intp)
+        advances = np.where(indices >= 0, atlas.dx[indices], 0)
+        # Pixel offset of every character, for character-wise scrolling
+        self._char_x = np.cumsum(advances) - advances
+        self._window_width = int(advances.max()) * self.max_characters
+        
+        period = max(1, run.advance)
+        height = (self.padding_top + self.font.ascent + self.font.descent +
+                  self.padding_bottom)
+        strip = np.zeros((max(1, height), period), dtype=np.uint8)
+        
+        # Glyph pixels hanging past either end wrap around, like the text
+        rows, cols = run.mask.shape
+        top = self.padding_top + self.font.ascent + run.top
+        row_1, row_2 = max(top, 0), min(top + rows, strip.shape[0])
+        if row_1 < row_2:
+            columns = (np.arange(cols) + run.left) % period
+            strip[row_1:row_2, columns] |= run.mask[row_1 - top:row_2 - top]
+        self._strip = strip
+        self._drawn_offset = None
+        
+    def _render_window(self):
+        """Copy the visible window of the strip into the label bitmap."""
+        offset = int(self._offset)
+        if offset == self._drawn_offset:
+            return
+            
+        strip = self._strip
+        width = self._window_width + self.padding_left + self.padding_right
+        height = strip.shape[0]
+        self._text_width = width
+        self._text_height = height
+        
+        if self._palette is None:
+            self._palette = Palette(2)
+            self._update_palette()
+        if (self._bitmap is None or self._bitmap.width != width or
+                self._bitmap.height != height):
+            self._bitmap = Bitmap(width, height, 2)
+            self._replace_tilegrid()
+            
+        columns = np.arange(offset, offset + self._window_width)
+        window = self._bitmap._buffer[:, self.padding_left:self.padding_left + self._window_width]
+        window[:] = np.take(strip, columns, axis=1, mode='wrap')
+        self._bitmap.dirty()
+        self._drawn_offset = offset
+        
+        self._update_position()
         
     def update(self, force=False):
         """Update the scroll position if enough time has passed.
@@ -111,6 +215,9 @@ class ScrollingLabel(Label):
         """
         current_time = time.monotonic()
         
+        if self.speed is not None and not force:
+            return self._advance_smooth(current_time)
+            
         if force or (self._is_scrolling and 
                      current_time - self._last_animate_time >= self.animate_time):
             self.scroll()
@@ -119,6 +226,42 @@ class ScrollingLabel(Label):
             
         return False
         
+    def _advance_smooth(self, current_time):
+        """Move the window by pixels on a fixed timestep.
+        
+        Elapsed time is consumed in whole 1/frame_rate steps, so a late
+        frame catches up instead of slowing the scroll; the remainder
+        carries over to the next call.
+        
+        Args:
+            current_time: time.monotonic() value
+            
+        Returns:
+            True if the window moved, False otherwise
+        """
+        if not self._is_scrolling or len(self._full_text) <= self.max_characters:
+            return False
+            
+        elapsed = min(current_time - self._last_animate_time, self.max_catchup)
+        self._last_animate_time = current_time
+        self._accumulator += max(0.0, elapsed)
+        
+        steps = int(self._accumulator * self.frame_rate + 1e-6)
+        if not steps:
+            return False
+        self._accumulator -= steps / self.frame_rate
+        
+        if self._strip is None:
+            self._build_strip()
+        period = self._strip.shape[1]
+        self._offset = (self._offset + self.speed * steps / self.frame_rate) % period
+        self.current_index = max(0, int(np.searchsorted(self._char_x, self._offset, side='right')) - 1)
+        
+        moved = int(self._offset) != self._drawn_offset
+        self._text = self._get_visible_text()
+        self._render_window()
+        return moved
+        
     def scroll(self):
         """Scroll the text by one character."""
         if len(self._full_text) > self.max_characters:
@@ -139,6 +282,7 @@ class ScrollingLabel(Label):
         """Start automatic scrolling."""
         self._is_scrolling = True
         self._last_animate_time = time.monotonic()
+        self._accumulator = 0.0
         
     def stop_scrolling(self):
         """Stop automatic scrolling."""
@@ -147,6 +291,8 @@ class ScrollingLabel(Label):
     def reset_scrolling(self):
         """Reset scroll position to beginning."""
         self.current_index = 0
+        self._offset = 0.0
+        self._accumulator = 0.0
         self._update_visible_text()
         
     @property
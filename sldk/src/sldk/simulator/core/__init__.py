@@ -3,6 +3,10 @@
 from .led_matrix import LEDMatrix
 from .display_manager import DisplayManager
 from .pixel_buffer import PixelBuffer
+from .performance_manager import PerformanceManager
+from .virtual_clock import VirtualClock, VirtualEventLoop
+from .headless_manager import HeadlessDisplayManager
 from .color_utils import *
 
-__all__ = ['LEDMatrix', 'DisplayManager', 'PixelBuffer']
\ No newline at end of file
+__all__ = ['LEDMatrix', 'DisplayManager', 'PixelBuffer', 'PerformanceManager',
+           'VirtualClock', 'VirtualEventLoop', 'HeadlessDisplayManager']
\ No newline at end of file
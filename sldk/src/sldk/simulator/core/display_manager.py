@@ -24,6 +24,8 @@ class DisplayManager:
         self.target_fps = 60
         self.event_handlers = {}
         self.update_callback = None
+        # Set when the whole window must be repainted (first frame, expose, resize)
+        self._full_redraw = True
         
     def add_display(self, display, position=(0, 0), name=None):
         """Add a display at specified position.
@@ -76,6 +78,7 @@ class DisplayManager:
         
         # Create clock for FPS control
         self.clock = pygame.time.Clock()
+        self._full_redraw = True
         
     def _update_window_size(self):
         """Update window size based on display positions."""
@@ -95,22 +98,33 @@ class DisplayManager:
         self.window_height = max_y + 4
         
     def update(self):
-        """Update all displays and window."""
+        """Update all displays and window.
+        
+        Only the areas each display reports as changed are copied to the
+        window and pushed with pygame.display.update(); a full repaint
+        happens on the first frame and after expose/resize events.
+        """
         if not self.window:
             return
             
-        # Clear window
-        self.window.fill(self.background_color)
-        
-        # Render and blit each display
+        full_redraw = self._full_redraw
+        if full_redraw:
+            self.window.fill(self.background_color)
+            for display in self.displays:
+                display.invalidate()
+                
+        # Render and copy the changed areas of each display
+        updated = []
         for display in self.displays:
-            display.render()
-            surface = display.get_surface()
             position = self.display_positions[display]
-            self.window.blit(surface, position)
+            updated.extend(display.present(self.window, position))
             
         # Update display
-        pygame.display.flip()
+        if full_redraw:
+            pygame.display.flip()
+            self._full_redraw = False
+        elif updated:
+            pygame.display.update(updated)
         
         # Control frame rate
         if self.clock:
@@ -126,6 +140,9 @@ class DisplayManager:
             if event.type == pygame.QUIT:
                 return False
                 
+            if event.type in (pygame.VIDEOEXPOSE, pygame.VIDEORESIZE):
+                self._full_redraw = True
+                
             # Check custom event handlers
             if event.type in self.event_handlers:
                 self.event_handlers[event.type](event)
@@ -0,0 +1,131 @@
+"""Display manager that runs without a window."""
+
+from .virtual_clock import VirtualClock
+
+
+class HeadlessDisplayManager:
+    """Drop-in replacement for DisplayManager with no pygame window.
+    
+    Each update() renders every display into its numpy buffers and
+    advances a VirtualClock by exactly one frame, so main loops run as
+    fast as the CPU allows while seeing the same timestamps they would
+    at target_fps in real time.
+    """
+    
+    def __init__(self, clock=None):
+        """Initialize headless display manager.
+        
+        Args:
+            clock: VirtualClock to advance (created if None)
+        """
+        self.clock = clock or VirtualClock()
+        self.displays = []
+        self.display_positions = {}
+        self.window = None
+        self.running = False
+        self.target_fps = self.clock.frame_rate
+        self.event_handlers = {}
+        self.update_callback = None
+        
+    def add_display(self, display, position=(0, 0), name=None):
+        """Add a display at specified position.
+        
+        Args:
+            display: LEDMatrix instance
+            position: (x, y) position (kept for API compatibility)
+            name: Optional name for the display
+        """
+        self.displays.append(display)
+        self.display_positions[display] = position
+        
+        if name:
+            self.display_positions[name] = display
+        
+    def create_window(self, *args, **kwargs):
+        """No-op; there is no window in headless mode."""
+        
+    def update(self):
+        """Render all displays and advance the clock by one frame."""
+        for display in self.displays:
+            display.render()
+        self.clock.tick(self.target_fps)
+        
+    def handle_events(self):
+        """No events in headless mode.
+        
+        Returns:
+            True while running
+        """
+        return True
+        
+    def run(self, update_callback=None, frames=None, duration=None):
+        """Run the main loop in virtual time.
+        
+        Without frames or duration the loop runs until update_callback
+        sets self.running to False (or calls quit()).
+        
+        Args:
+            update_callback: Optional function to call each frame
+            frames: Stop after this many frames
+            duration: Stop after this many virtual seconds
+        """
+        self.running = True
+        self.update_callback = update_callback
+        
+        end_time = None
+        if duration is not None:
+            end_time = self.clock.monotonic() + duration
+        start_frame = self.clock.frame
+        
+        with self.clock.patch():
+            while self.running:
+                if frames is not None and self.clock.frame - start_frame >= frames:
+                    break
+                if end_time is not None and self.clock.monotonic() >= end_time:
+                    break
+                
+                if self.update_callback:
+                    self.update_callback()
+                self.update()
+        
+        self.running = False
+        
+    def run_once(self):
+        """Run a single update cycle."""
+        with self.clock.patch():
+            if self.update_callback:
+                self.update_callback()
+            self.update()
+        
+    def quit(self):
+        """Stop the main loop."""
+        self.running = False
+        
+    def save_screenshot(self, filename):
+        """Save a screenshot of the first display.
+        
+        Args:
+            filename: Path to save the screenshot
+        """
+        if self.displays:
+            self.displays[0].save_screenshot(filename)
+        
+    def set_event_handler(self, event_type, handler):
+        """Set a custom event handler (never called in headless mode).
+        
+        Args:
+            event_type: Pygame event type
+            handler: Function to call for this event type
+        """
+        self.event_handlers[event_type] = handler
+        
+    def get_display_by_name(self, name):
+        """Get a display by its name.
+        
+        Args:
+            name: Display name
+        
+        Returns:
+            Display instance or None
+        """
+        return self.display_positions.get(name)
@@ -3,7 +3,13 @@
 import pygame
 import numpy as np
 from .pixel_buffer import PixelBuffer
-from .color_utils import apply_brightness
+
+
+# Zones of the LED mask; each surface pixel falls in exactly one
+_ZONE_BACKGROUND = 0
+_ZONE_OUTLINE = 1
+_ZONE_BODY = 2
+_ZONE_HIGHLIGHT = 3
 
 
 class LEDMatrix:
@@ -13,7 +19,8 @@ class LEDMatrix:
     including realistic LED rendering with configurable pitch and appearance.
     """
     
-    def __init__(self, width, height, pitch=3.0, led_size=None, performance_manager=None):
+    def __init__(self, width, height, pitch=3.0, led_size=None, performance_manager=None,
+                 headless=False):
         """Initialize LED matrix.
         
         Args:
@@ -22,10 +29,13 @@ class LEDMatrix:
             pitch: LED pitch in mm (2.5, 3, 4, 5, or 6)
             led_size: Optional LED size override in pixels
             performance_manager: Optional performance simulation manager
+            headless: Keep pixels in numpy buffers only; LEDs are
+                rasterized on demand for screenshots instead of every render
         """
         self.width = width
         self.height = height
         self.pitch = pitch
+        self.headless = headless
         
         # Calculate LED size and spacing based on pitch
         # For a given pitch, LED size is typically 80% of pitch
@@ -47,19 +57,27 @@ class LEDMatrix:
         
         # Create pygame surface for rendering
         self.surface = None
-        self._led_cache = {}  # Cache rendered LED circles
         self._background_color = (30, 30, 30)  # Medium gray background for realistic appearance
         
+        # Precomputed LED mask and surface-to-LED lookup
+        self._build_led_geometry()
+        
+        # Surface areas redrawn since the last present()
+        self._damage = []
+        
     def initialize_surface(self):
         """Initialize the pygame surface for rendering."""
+        if self.headless:
+            # No persistent surface; get_surface() builds one on demand
+            self.pixel_buffer.mark_all_dirty()
+            return
+            
         if not pygame.get_init():
             pygame.init()
             
         self.surface = pygame.Surface((self.surface_width, self.surface_height))
         self.surface.fill(self._background_color)
-        
-        # Pre-render some common LED appearances for performance
-        self._create_led_cache()
+        self.pixel_buffer.mark_all_dirty()
         
     def set_pixel(self, x, y, color):
         """Set a single pixel color.
@@ -107,129 +125,229 @@ class LEDMatrix:
         """
         self.brightness = max(0.0, min(1.0, brightness))
         
+    def load_frame(self, frame):
+        """Replace the pixel contents with a complete composed frame.
+        
+        Args:
+            frame: Numpy array of shape (height, width, 3)
+            
+        Returns:
+            Number of pixels that changed
+        """
+        changed = self.pixel_buffer.load_frame(frame)
+        if changed and self.performance_manager and self.performance_manager.enabled:
+            # Simulate the pixel writes that actually happened
+            self.performance_manager.simulate_instruction_delay(3 * changed)
+        return changed
+        
+    def invalidate(self):
+        """Force the next render to redraw every LED."""
+        self.pixel_buffer.mark_all_dirty()
+        
     def render(self):
-        """Render the matrix to pygame surface."""
+        """Render the matrix to pygame surface.
+        
+        Only LEDs inside the pixel buffer's dirty rectangles are
+        re-rasterized. The touched surface areas are also accumulated
+        until the next present().
+        
+        Returns:
+            List of pygame.Rect in surface coordinates that were redrawn
+        """
+        if self.headless:
+            return self._render_headless()
+            
         if self.surface is None:
             self.initialize_surface()
             
+        if not self.pixel_buffer.is_dirty():
+            self._simulate_refresh(0)
+            return []
+            
+        dirty_rects = self.pixel_buffer.get_dirty_rects()
+        dirty_area = self._dirty_area(dirty_rects)
+        # Past half the panel one full pass is cheaper than many blocks
+        if dirty_area * 2 > self.width * self.height:
+            dirty_rects = None
+                
+        self._simulate_refresh(dirty_area)
+        
+        if dirty_rects is None:
+            self._render_full()
+            rendered = [self.surface.get_rect()]
+        else:
+            rendered = [self._render_block(x1, y1, x2 + 1, y2 + 1)
+                        for x1, y1, x2, y2 in dirty_rects]
+            
+        self.pixel_buffer.clear_dirty()
+        
+        self._damage.extend(rendered)
+        if len(self._damage) > self.pixel_buffer.MAX_DIRTY_RECTS:
+            # Nobody is presenting; don't let the damage list grow
+            self._damage = [self.surface.get_rect()]
+        return rendered
+        
+    def _render_headless(self):
+        """Consume the dirty state without rasterizing anything.
+        
+        Returns:
+            Empty list; there is no surface to redraw
+        """
+        pixels = 0
+        if self.pixel_buffer.is_dirty():
+            pixels = self._dirty_area(self.pixel_buffer.get_dirty_rects())
+            self.pixel_buffer.clear_dirty()
+        self._simulate_refresh(pixels)
+        return []
+        
+    def _dirty_area(self, dirty_rects):
+        """Number of pixels covered by a dirty rectangle list.
+        
+        Args:
+            dirty_rects: List of inclusive (x1, y1, x2, y2), or None for all
+            
+        Returns:
+            Pixel count
+        """
+        if dirty_rects is None:
+            return self.width * self.height
+        return sum((x2 - x1 + 1) * (y2 - y1 + 1)
+                   for x1, y1, x2, y2 in dirty_rects)
+        
+    def _simulate_refresh(self, pixels):
+        """Charge the hardware cost of a refresh to the performance manager.
+        
+        Args:
+            pixels: Number of pixels the refresh had to push
+        """
         if self.performance_manager and self.performance_manager.enabled:
             # Simulate display refresh delay
-            self.performance_manager.simulate_io_operation("display_refresh")
+            self.performance_manager.simulate_io_operation("display_refresh", pixels=pixels)
             # Simulate potential GC pause during rendering
             self.performance_manager.simulate_gc_pause()
             
-        # Only update dirty regions if tracking is enabled
-        if self.pixel_buffer.is_dirty():
-            dirty_region = self.pixel_buffer.get_dirty_region()
-            
-            if dirty_region is None:
-                # Full update
-                self._render_full()
-            else:
-                # Partial update (future optimization)
-                self._render_full()  # For now, always do full update
-                
-            self.pixel_buffer.clear_dirty()
+    def present(self, target, position=(0, 0)):
+        """Render and copy only the changed areas onto a target surface.
+        
+        Args:
+            target: Pygame surface to draw on (usually the window)
+            position: (x, y) of this matrix on the target
+            
+        Returns:
+            List of pygame.Rect in target coordinates, suitable for
+            pygame.display.update()
+        """
+        self.render()
+        if self.headless:
+            return []
             
+        offset_x, offset_y = position
+        updated = []
+        for rect in self._damage:
+            target.blit(self.surface, (offset_x + rect.x, offset_y + rect.y), rect)
+            updated.append(rect.move(offset_x, offset_y))
+        self._damage = []
+        return updated
+        
     def _render_full(self):
-        """Render all LEDs to the surface."""
-        # Clear surface
-        self.surface.fill(self._background_color)
+        """Render all LEDs to the surface in a single array pass."""
+        frame = self.rasterize(0, 0, self.width, self.height)
+        pygame.surfarray.blit_array(self.surface, frame.swapaxes(0, 1))
         
-        # Get pixel data
-        pixels = self.pixel_buffer.get_buffer()
-        
-        # Render each LED
-        for y in range(self.height):
-            for x in range(self.width):
-                color = tuple(pixels[y, x])
-                if self.brightness < 1.0:
-                    color = apply_brightness(color, self.brightness)
-                    
-                self._render_led(x, y, color)
-                
-    def _render_led(self, x, y, color):
-        """Render a single LED at the given position.
+    def _render_block(self, x1, y1, x2, y2):
+        """Render a block of LEDs to the surface.
         
         Args:
-            x: LED X position
-            y: LED Y position
-            color: Color as (r, g, b) tuple
-        """
-        # Calculate LED position on surface
-        led_x = x * (self.led_size + self.spacing)
-        led_y = y * (self.led_size + self.spacing)
-        
-        # Check if we have this LED appearance cached
-        # Convert to regular Python ints to avoid numpy type issues
-        cache_key = (int(color[0]), int(color[1]), int(color[2]))
-        if cache_key in self._led_cache:
-            led_surface = self._led_cache[cache_key]
-        else:
-            # Create new LED appearance
-            led_surface = self._create_led_surface(color)
-            # Cache it if cache isn't too large
-            if len(self._led_cache) < 256:
-                self._led_cache[cache_key] = led_surface
-                
-        # Blit LED to main surface
-        self.surface.blit(led_surface, (led_x, led_y))
+            x1, y1: Top-left LED of the block (inclusive)
+            x2, y2: Bottom-right LED of the block (exclusive)
+            
+        Returns:
+            pygame.Rect of the surface area that was drawn
+        """
+        block = self.rasterize(x1, y1, x2, y2)
+        step = self.led_size + self.spacing
+        block_surface = pygame.surfarray.make_surface(block.swapaxes(0, 1))
+        return self.surface.blit(block_surface, (x1 * step, y1 * step))
         
-    def _create_led_surface(self, color):
-        """Create a surface for a single LED with given color.
+    def rasterize(self, x1, y1, x2, y2):
+        """Rasterize a block of LEDs into surface pixels.
+        
+        Every surface pixel belongs to one LED and one zone of the LED
+        mask (background, outline, body or highlight). A per-LED color
+        table is built for the block and the output is a single gather
+        through the precomputed surface-to-table index map.
         
         Args:
-            color: Color as (r, g, b) tuple
+            x1, y1: Top-left LED of the block (inclusive)
+            x2, y2: Bottom-right LED of the block (exclusive)
             
         Returns:
-            Pygame surface with rendered LED
+            Numpy array of shape (rows, cols, 3) in surface pixel space
         """
-        # Create surface with per-pixel alpha
-        led_surface = pygame.Surface((self.led_size, self.led_size), pygame.SRCALPHA)
+        pixels = self.pixel_buffer.get_buffer()[y1:y2, x1:x2]
+        block_height, block_width = pixels.shape[:2]
+        
+        # Brightness is one vector multiply; full brightness gets the
+        # same 15% boost the original per-LED renderer applied
+        if self.brightness < 1.0:
+            lit = (pixels * self.brightness).astype(np.uint16)
+            body = lit
+        else:
+            lit = pixels.astype(np.uint16)
+            body = np.minimum((lit * 1.15).astype(np.uint16), 255)
+            
+        # "Off" LEDs are drawn as visible dark grey circles
+        off = lit.sum(axis=2) <= 20
+        
+        table = np.empty((block_height, block_width, 4, 3), dtype=np.uint8)
+        table[:, :, _ZONE_BACKGROUND] = self._background_color
+        table[:, :, _ZONE_OUTLINE] = body
+        table[:, :, _ZONE_BODY] = body
+        table[:, :, _ZONE_HIGHLIGHT] = np.minimum(body + 15, 255)
+        table[off, _ZONE_OUTLINE] = (40, 40, 40)
+        table[off, _ZONE_BODY] = (60, 60, 60)
+        table[off, _ZONE_HIGHLIGHT] = (60, 60, 60)
+        table = table.reshape(-1, 3)
+        
+        if (x1, y1, x2, y2) == (0, 0, self.width, self.height):
+            index = self._gather_index
+        else:
+            step = self.led_size + self.spacing
+            sx1, sx2 = x1 * step, min(x2 * step, self.surface_width)
+            sy1, sy2 = y1 * step, min(y2 * step, self.surface_height)
+            rows = self._led_rows[sy1:sy2, None] - y1
+            cols = self._led_cols[None, sx1:sx2] - x1
+            index = (rows * block_width + cols) * 4 + self._zone_map[sy1:sy2, sx1:sx2]
+            
+        return np.take(table, index, axis=0)
         
-        # Draw LED as a perfect circle to simulate real LED
+    def _build_led_geometry(self):
+        """Precompute the LED mask and the surface-to-LED index map."""
+        step = self.led_size + self.spacing
         center = self.led_size // 2
-        radius = self.led_size // 2 - 1
-        
-        # For 100% brightness, enhance the LED appearance for maximum visibility
-        enhanced_color = color
-        if hasattr(self, 'brightness') and self.brightness == 1.0:
-            # At 100% brightness, make LEDs extra bright by enhancing the base color
-            enhanced_color = tuple(min(255, int(c * 1.15)) for c in color)
-        
-        # For realistic LED matrix appearance, "off" LEDs should be visible
-        color_sum = int(color[0]) + int(color[1]) + int(color[2])
-        
-        if color_sum <= 20:  # "Off" LEDs - show as dark grey circles
-            # Draw visible "off" LED as dark grey circle
-            off_led_color = (60, 60, 60)  # Dark grey but visible
-            pygame.draw.circle(led_surface, off_led_color, (center, center), radius)
-            # Add subtle darker outline for depth
-            pygame.draw.circle(led_surface, (40, 40, 40), (center, center), radius, 1)
-        else:
-            # Draw main LED circle for "on" LEDs
-            pygame.draw.circle(led_surface, enhanced_color, (center, center), radius)
-            
-            # Add subtle gradient for realism without creating diamond shape
-            # Create a smaller, dimmer circle for subtle depth
-            # Avoid sharp highlights that create diamond appearance
-            inner_radius = max(1, radius - 3)
-            gradient_intensity = 15  # Very subtle
-            gradient_color = tuple(min(255, int(c) + gradient_intensity) for c in enhanced_color)
-            pygame.draw.circle(led_surface, gradient_color, (center, center), inner_radius)
-            
-        return led_surface
-        
-    def _create_led_cache(self):
-        """Pre-create commonly used LED appearances."""
-        # Cache black LED
-        self._led_cache[(0, 0, 0)] = self._create_led_surface((0, 0, 0))
-        
-        # Cache primary colors at full brightness
-        for color in [(255, 0, 0), (0, 255, 0), (0, 0, 255), 
-                      (255, 255, 0), (255, 0, 255), (0, 255, 255),
-                      (255, 255, 255)]:
-            self._led_cache[color] = self._create_led_surface(color)
+        radius = max(0, self.led_size // 2 - 1)
+        body_radius = radius - 1
+        inner_radius = min(radius, max(1, radius - 3))
+        
+        offsets = np.arange(self.led_size) - center
+        dist_sq = offsets[:, None] ** 2 + offsets[None, :] ** 2
+        
+        # One LED cell including its spacing; spacing stays background
+        cell = np.full((step, step), _ZONE_BACKGROUND, dtype=np.intp)
+        led = cell[:self.led_size, :self.led_size]
+        led[dist_sq <= radius * radius] = _ZONE_OUTLINE
+        if body_radius >= 0:
+            led[dist_sq <= body_radius * body_radius] = _ZONE_BODY
+        led[dist_sq <= inner_radius * inner_radius] = _ZONE_HIGHLIGHT
+        
+        self._zone_map = np.tile(cell, (self.height, self.width))[
+            :self.surface_height, :self.surface_width]
+        self._led_rows = np.arange(self.surface_height, dtype=np.intp) // step
+        self._led_cols = np.arange(self.surface_width, dtype=np.intp) // step
+        self._gather_index = (
+            (self._led_rows[:, None] * self.width + self._led_cols[None, :]) * 4
+            + self._zone_map
+        )
             
     def get_surface(self):
         """Get the pygame surface for this matrix.
@@ -237,15 +355,28 @@ class LEDMatrix:
         Returns:
             Pygame surface containing rendered LEDs
         """
+        if self.headless:
+            frame = self.rasterize(0, 0, self.width, self.height)
+            return pygame.surfarray.make_surface(frame.swapaxes(0, 1))
         if self.surface is None:
             self.initialize_surface()
         return self.surface
         
+    def get_frame(self):
+        """Get a copy of the current pixel contents.
+        
+        Returns:
+            Numpy array of shape (height, width, 3), dtype uint8
+        """
+        return self.pixel_buffer.get_buffer().copy()
+        
     def save_screenshot(self, filename):
         """Save a screenshot of the current matrix state.
         
         Args:
             filename: Path to save the screenshot
         """
-        if self.surface:
+        if self.headless:
+            pygame.image.save(self.get_surface(), filename)
+        elif self.surface:
             pygame.image.save(self.surface, filename)
\ No newline at end of file
@@ -0,0 +1,290 @@
+"""Hardware timing model for the simulator.
+
+Approximates how long CircuitPython code takes on real boards so that
+animations can be checked for frame rate on a desktop before flashing.
+Costs are not emulated cycle by cycle; each simulated operation charges
+a calibrated number of microseconds to a running total, and optionally
+sleeps so the simulator runs at hardware speed.
+"""
+
+import time
+
+
+# Per-board cost tables. Times are in microseconds unless noted.
+PROFILES = {
+    # MatrixPortal S3: ESP32-S3 at 240MHz, CircuitPython heap in PSRAM,
+    # 64x32 HUB75 panel driven by rgbmatrix
+    "ESP32-S3": {
+        "cpu_mhz": 240,
+        "instruction_us": 1.6,          # One simple bytecode operation
+        "refresh_overhead_us": 900,     # displayio refresh bookkeeping
+        "refresh_pixel_us": 0.45,       # Compose + RGB565 copy per pixel
+        "heap_bytes": 2 * 1024 * 1024,  # Usable GC heap
+        "gc_threshold": 0.75,           # Heap fraction that triggers a collect
+        "gc_base_us": 1500,             # Fixed cost of a collection
+        "gc_us_per_kb": 6.0,            # Mark/sweep cost per live KB
+        "gc_live_fraction": 0.4,        # Share of the heap surviving a collect
+        "io_us": {
+            "display_refresh": 0,       # Priced by refresh_* above
+            "read": 200,
+            "write": 350,
+            "flash_read": 400,
+            "flash_write": 12000,
+        },
+        "http_connect_ms": 180,         # WiFi + TCP connect
+        "http_tls_ms": 900,             # TLS handshake
+        "http_first_byte_ms": 120,      # Server think time seen by the board
+        "http_kb_per_s": 90,            # adafruit_requests throughput
+    },
+    "SAMD51": {
+        "cpu_mhz": 120,
+        "instruction_us": 3.5,
+        "refresh_overhead_us": 1500,
+        "refresh_pixel_us": 1.2,
+        "heap_bytes": 192 * 1024,
+        "gc_threshold": 0.75,
+        "gc_base_us": 800,
+        "gc_us_per_kb": 12.0,
+        "gc_live_fraction": 0.5,
+        "io_us": {
+            "display_refresh": 0,
+            "read": 300,
+            "write": 500,
+            "flash_read": 600,
+            "flash_write": 15000,
+        },
+        "http_connect_ms": 400,         # Via the AirLift coprocessor
+        "http_tls_ms": 1200,
+        "http_first_byte_ms": 120,
+        "http_kb_per_s": 40,
+    },
+}
+
+DEFAULT_PROFILE = "ESP32-S3"
+
+
+class PerformanceManager:
+    """Charges simulated hardware time for display and network operations.
+    
+    Interface used by LEDMatrix: ``enabled``, ``simulate_instruction_delay``,
+    ``simulate_io_operation`` and ``simulate_gc_pause``. Everything charged
+    between ``begin_frame()`` and ``end_frame()`` is counted as that frame's
+    cost, so ``estimated_fps()`` tells whether an animation will hold its
+    frame rate on the board.
+    """
+    
+    def __init__(self, hardware_profile=DEFAULT_PROFILE, speed_multiplier=1.0,
+                 realtime=True, sleep=None, **overrides):
+        """Initialize performance manager.
+        
+        Args:
+            hardware_profile: Name of an entry in PROFILES
+            speed_multiplier: Scale applied to every charged cost
+                (2.0 = twice as slow as hardware)
+            realtime: Sleep for charged time so the simulator runs at
+                hardware speed; False only accumulates the totals
+            sleep: Sleep function; defaults to time.sleep looked up at
+                call time, so a patched virtual clock is honoured
+            **overrides: Individual profile values to replace
+        """
+        if hardware_profile not in PROFILES:
+            raise ValueError(f"Unknown hardware profile: {hardware_profile}")
+        
+        self.hardware_profile = hardware_profile
+        self.profile = dict(PROFILES[hardware_profile])
+        self.profile["io_us"] = dict(self.profile["io_us"])
+        for key, value in overrides.items():
+            if key not in self.profile:
+                raise ValueError(f"Unknown profile setting: {key}")
+            self.profile[key] = value
+        
+        self.enabled = True
+        self.speed_multiplier = speed_multiplier
+        self.realtime = realtime
+        self._sleep = sleep
+        
+        # Heap model
+        self.heap_used = 0
+        
+        # Accounting
+        self.total_us = 0.0
+        self.frame_us = 0.0
+        self.in_frame = False
+        self._frame_times = []
+        self._pending_sleep_us = 0.0
+        self.stats = {
+            "instructions": 0,
+            "refreshes": 0,
+            "refresh_pixels": 0,
+            "gc_collections": 0,
+            "gc_us": 0.0,
+            "http_requests": 0,
+        }
+        
+    def simulate_instruction_delay(self, instruction_count=1):
+        """Charge the cost of simple interpreter operations.
+        
+        Args:
+            instruction_count: Number of bytecode-level operations
+        """
+        if not self.enabled:
+            return
+        self.stats["instructions"] += instruction_count
+        self._charge(instruction_count * self.profile["instruction_us"])
+        
+    def simulate_memory_constraint(self, allocation_size):
+        """Account for a heap allocation.
+        
+        Args:
+            allocation_size: Size of the allocation in bytes
+        
+        Raises:
+            MemoryError: If the allocation cannot fit even after a collect
+        """
+        if not self.enabled:
+            return
+        heap_bytes = self.profile["heap_bytes"]
+        if self.heap_used + allocation_size > heap_bytes:
+            self._collect()
+            if self.heap_used + allocation_size > heap_bytes:
+                raise MemoryError(
+                    f"memory allocation failed, allocating {allocation_size} bytes")
+        self.heap_used += allocation_size
+        
+    def simulate_gc_pause(self):
+        """Run a collection if the heap model is past its threshold."""
+        if not self.enabled:
+            return
+        if self.heap_used >= self.profile["heap_bytes"] * self.profile["gc_threshold"]:
+            self._collect()
+        
+    def simulate_io_operation(self, operation_type="read", pixels=None):
+        """Charge the cost of an I/O operation.
+        
+        Args:
+            operation_type: Key of the profile's io_us table
+            pixels: For "display_refresh", the number of pixels pushed;
+                None or 0 charges only the fixed refresh overhead
+        """
+        if not self.enabled:
+            return
+        cost = self.profile["io_us"].get(operation_type, self.profile["io_us"]["read"])
+        if operation_type == "display_refresh":
+            self.stats["refreshes"] += 1
+            cost += self.profile["refresh_overhead_us"]
+            if pixels:
+                self.stats["refresh_pixels"] += pixels
+                cost += pixels * self.profile["refresh_pixel_us"]
+                # displayio allocates a row buffer per refresh area
+                self.simulate_memory_constraint(pixels * 2)
+        self._charge(cost)
+        
+    def simulate_http_request(self, response_bytes=0, tls=True, reuse_connection=False):
+        """Charge the latency of an HTTP request made with adafruit_requests.
+        
+        Args:
+            response_bytes: Size of the response body
+            tls: Whether the request is HTTPS
+            reuse_connection: Skip connect and handshake (keep-alive)
+        
+        Returns:
+            Simulated latency in seconds
+        """
+        if not self.enabled:
+            return 0.0
+        ms = self.profile["http_first_byte_ms"]
+        if not reuse_connection:
+            ms += self.profile["http_connect_ms"]
+            if tls:
+                ms += self.profile["http_tls_ms"]
+        ms += response_bytes / 1024 / self.profile["http_kb_per_s"] * 1000
+        self.stats["http_requests"] += 1
+        
+        # The response text lands on the heap
+        if response_bytes:
+            self.simulate_memory_constraint(response_bytes)
+        self._charge(ms * 1000)
+        return ms * self.speed_multiplier / 1000
+        
+    def begin_frame(self):
+        """Start accounting a new frame."""
+        self.frame_us = 0.0
+        self.in_frame = True
+        
+    def end_frame(self):
+        """Finish the current frame.
+        
+        Returns:
+            Simulated frame time in seconds
+        """
+        self.in_frame = False
+        self._frame_times.append(self.frame_us)
+        if len(self._frame_times) > 120:
+            del self._frame_times[0]
+        self._flush_sleep(force=True)
+        return self.frame_us / 1000000
+        
+    def estimated_fps(self):
+        """Frame rate the hardware would reach for recent frames.
+        
+        Returns:
+            Frames per second, or None before any frame has completed
+        """
+        if not self._frame_times:
+            return None
+        average_us = sum(self._frame_times) / len(self._frame_times)
+        if average_us <= 0:
+            return float("inf")
+        return 1000000 / average_us
+        
+    def can_hold(self, target_fps):
+        """Check whether recent frames fit the target frame budget.
+        
+        Args:
+            target_fps: Desired frame rate
+        
+        Returns:
+            True if every recent frame finished within 1/target_fps
+        """
+        if not self._frame_times:
+            return True
+        budget_us = 1000000 / target_fps
+        return max(self._frame_times) <= budget_us
+        
+    def reset(self):
+        """Clear accounting and the heap model."""
+        self.heap_used = 0
+        self.total_us = 0.0
+        self.frame_us = 0.0
+        self.in_frame = False
+        self._frame_times = []
+        self._pending_sleep_us = 0.0
+        for key in self.stats:
+            self.stats[key] = 0
+        
+    def _collect(self):
+        """Model a garbage collection: pause, then shrink the heap."""
+        live_kb = self.heap_used * self.profile["gc_live_fraction"] / 1024
+        pause = self.profile["gc_base_us"] + live_kb * self.profile["gc_us_per_kb"]
+        self.heap_used = int(self.heap_used * self.profile["gc_live_fraction"])
+        self.stats["gc_collections"] += 1
+        self.stats["gc_us"] += pause * self.speed_multiplier
+        self._charge(pause)
+        
+    def _charge(self, microseconds):
+        """Add simulated time and sleep off what has accumulated."""
+        microseconds *= self.speed_multiplier
+        self.total_us += microseconds
+        self.frame_us += microseconds
+        if self.realtime:
+            self._pending_sleep_us += microseconds
+            self._flush_sleep()
+        
+    def _flush_sleep(self, force=False):
+        """Sleep in chunks; individual pixel costs are far below timer resolution."""
+        if not self.realtime:
+            return
+        if self._pending_sleep_us >= 2000 or (force and self._pending_sleep_us > 0):
+            sleep = self._sleep or time.sleep
+            sleep(self._pending_sleep_us / 1000000)
+            self._pending_sleep_us = 0.0
@@ -7,9 +7,17 @@ class PixelBuffer:
     """Manages the pixel data for an LED matrix.
     
     This class provides efficient storage and manipulation of pixel data
-    using numpy arrays for performance.
+    using numpy arrays for performance. Modifications are tracked as a
+    short list of dirty rectangles so renderers can redraw only what
+    changed.
     """
     
+    # Beyond this many rectangles the dirty set collapses to its bounding box
+    MAX_DIRTY_RECTS = 16
+    
+    # Granularity used when diffing whole frames in load_frame()
+    DIFF_TILE_SIZE = 8
+    
     def __init__(self, width, height):
         """Initialize pixel buffer.
         
@@ -21,8 +29,9 @@ class PixelBuffer:
         self.height = height
         # Store pixels as RGB888 internally for better color accuracy
         self._buffer = np.zeros((height, width, 3), dtype=np.uint8)
+        # Dirty state: None means the whole buffer is dirty
         self._dirty = True
-        self._dirty_region = None
+        self._dirty_rects = None
         
     def set_pixel(self, x, y, color):
         """Set a single pixel color.
@@ -75,13 +84,13 @@ class PixelBuffer:
             self._buffer[:] = [r, g, b]
             
         self._dirty = True
-        self._dirty_region = None
+        self._dirty_rects = None
         
     def clear(self):
         """Clear all pixels to black."""
         self._buffer.fill(0)
         self._dirty = True
-        self._dirty_region = None
+        self._dirty_rects = None
         
     def blit(self, source, x=0, y=0, key_color=None):
         """Copy pixels from another buffer.
@@ -126,6 +135,43 @@ class PixelBuffer:
             
         self._mark_dirty(dst_x, dst_y, dst_x + copy_width - 1, dst_y + copy_height - 1)
         
+    def load_frame(self, frame):
+        """Replace the buffer contents with a complete frame.
+        
+        Only the tiles that actually differ from the current contents are
+        marked dirty, so re-composing an unchanged scene costs nothing
+        downstream.
+        
+        Args:
+            frame: Numpy array of shape (height, width, 3)
+            
+        Returns:
+            Number of pixels that changed
+        """
+        changed = np.any(frame != self._buffer, axis=2)
+        count = int(np.count_nonzero(changed))
+        if count == 0:
+            return 0
+            
+        np.copyto(self._buffer, frame)
+        
+        # Reduce the change mask to a coarse tile grid and mark each tile;
+        # _mark_dirty merges neighbouring tiles into rectangles
+        tile = self.DIFF_TILE_SIZE
+        rows = -(-self.height // tile)
+        cols = -(-self.width // tile)
+        tiles = np.zeros((rows * tile, cols * tile), dtype=bool)
+        tiles[:self.height, :self.width] = changed
+        tiles = tiles.reshape(rows, tile, cols, tile).any(axis=(1, 3))
+        
+        for ty, tx in zip(*np.nonzero(tiles)):
+            x1 = int(tx) * tile
+            y1 = int(ty) * tile
+            self._mark_dirty(x1, y1,
+                             min(x1 + tile, self.width) - 1,
+                             min(y1 + tile, self.height) - 1)
+        return count
+        
     def get_buffer(self):
         """Get the raw numpy buffer.
         
@@ -143,38 +189,75 @@ class PixelBuffer:
         return self._dirty
         
     def get_dirty_region(self):
-        """Get the region that has been modified.
+        """Get the bounding box of the modified area.
         
         Returns:
             Tuple of (x1, y1, x2, y2) or None if entire buffer is dirty
         """
-        return self._dirty_region
+        if not self._dirty_rects:
+            return None
+        return (
+            min(r[0] for r in self._dirty_rects),
+            min(r[1] for r in self._dirty_rects),
+            max(r[2] for r in self._dirty_rects),
+            max(r[3] for r in self._dirty_rects)
+        )
+        
+    def get_dirty_rects(self):
+        """Get the modified rectangles.
+        
+        Returns:
+            List of inclusive (x1, y1, x2, y2) tuples, or None if the
+            entire buffer is dirty
+        """
+        if self._dirty_rects is None:
+            return None
+        return list(self._dirty_rects)
+        
+    def mark_all_dirty(self):
+        """Mark the entire buffer as modified."""
+        self._dirty = True
+        self._dirty_rects = None
         
     def clear_dirty(self):
         """Clear the dirty flag."""
         self._dirty = False
-        self._dirty_region = None
+        self._dirty_rects = []
         
     def _mark_dirty(self, x1, y1, x2, y2):
         """Mark a region as dirty.
         
+        Rectangles that overlap or touch an existing dirty rectangle are
+        merged into it.
+        
         Args:
             x1, y1: Top-left corner
             x2, y2: Bottom-right corner
         """
+        if self._dirty and self._dirty_rects is None:
+            # Already fully dirty
+            return
+            
         self._dirty = True
+        rects = self._dirty_rects
         
-        if self._dirty_region is None:
-            self._dirty_region = (x1, y1, x2, y2)
-        else:
-            # Expand existing dirty region
-            old_x1, old_y1, old_x2, old_y2 = self._dirty_region
-            self._dirty_region = (
-                min(x1, old_x1),
-                min(y1, old_y1),
-                max(x2, old_x2),
-                max(y2, old_y2)
-            )
+        merged = True
+        while merged:
+            merged = False
+            for i in range(len(rects) - 1, -1, -1):
+                rx1, ry1, rx2, ry2 = rects[i]
+                if (rx1 <= x2 + 1 and x1 <= rx2 + 1 and
+                        ry1 <= y2 + 1 and y1 <= ry2 + 1):
+                    x1, y1 = min(x1, rx1), min(y1, ry1)
+                    x2, y2 = max(x2, rx2), max(y2, ry2)
+                    rects.pop(i)
+                    merged = True
+                    break
+                    
+        rects.append((x1, y1, x2, y2))
+        
+        if len(rects) > self.MAX_DIRTY_RECTS:
+            self._dirty_rects = [self.get_dirty_region()]
             
     def apply_brightness(self, brightness):
         """Apply brightness adjustment to all pixels.
@@ -184,4 +267,4 @@ class PixelBuffer:
         """
         self._buffer = (self._buffer * brightness).astype(np.uint8)
         self._dirty = True
-        self._dirty_region = None
\ No newline at end of file
+        self._dirty_rects = None
\ No newline at end of file
@@ -0,0 +1,165 @@
+"""Virtual time for running the simulator faster than real time.
+
+A VirtualClock only moves when something advances it: a frame tick from
+the headless display manager, a patched time.sleep(), or an asyncio
+event loop that has nothing to do until its next timer. Code written
+against time.monotonic()/asyncio.sleep() runs unchanged but finishes as
+fast as the CPU allows, and the timestamps it sees are reproducible.
+"""
+
+import asyncio
+import contextlib
+import selectors
+import time
+
+
+class VirtualClock:
+    """Deterministic clock advanced in exact steps.
+    
+    Time is kept as integer nanoseconds so that hours of 60 FPS frame
+    steps do not accumulate floating point drift.
+    """
+    
+    def __init__(self, start=0.0, frame_rate=60):
+        """Initialize virtual clock.
+        
+        Args:
+            start: Initial time in seconds
+            frame_rate: Frame rate used by tick() when none is given
+        """
+        self._ns = int(round(start * 1000000000))
+        self.frame_rate = frame_rate
+        self.frame = 0
+        
+    def time(self):
+        """Current virtual time in seconds (time.time replacement)."""
+        return self._ns / 1000000000
+    
+    monotonic = time
+    
+    def monotonic_ns(self):
+        """Current virtual time in nanoseconds."""
+        return self._ns
+        
+    def advance(self, seconds):
+        """Move the clock forward.
+        
+        Args:
+            seconds: Amount of virtual time to add; negative values are ignored
+        """
+        if seconds > 0:
+            self._ns += int(round(seconds * 1000000000))
+        
+    def sleep(self, seconds):
+        """Blocking sleep replacement that only advances virtual time.
+        
+        Args:
+            seconds: Time to sleep
+        """
+        self.advance(seconds)
+        
+    def tick(self, frame_rate=None):
+        """Advance by exactly one frame.
+        
+        Args:
+            frame_rate: Frames per second (defaults to self.frame_rate)
+        
+        Returns:
+            New frame number
+        """
+        rate = frame_rate or self.frame_rate
+        # Step between integer frame boundaries so the sum never drifts
+        step = ((self.frame + 1) * 1000000000 // rate
+                - self.frame * 1000000000 // rate)
+        self.frame += 1
+        self._ns += step
+        return self.frame
+        
+    @contextlib.contextmanager
+    def patch(self):
+        """Route time.time/monotonic/sleep through this clock.
+        
+        Modules that use ``import time`` (as the effects and display
+        code do) pick up virtual time without changes.
+        """
+        saved = (time.time, time.monotonic, time.monotonic_ns, time.sleep)
+        time.time = self.time
+        time.monotonic = self.monotonic
+        time.monotonic_ns = self.monotonic_ns
+        time.sleep = self.sleep
+        try:
+            yield self
+        finally:
+            time.time, time.monotonic, time.monotonic_ns, time.sleep = saved
+        
+    def new_event_loop(self):
+        """Create an asyncio event loop that runs on this clock.
+        
+        Returns:
+            VirtualEventLoop instance
+        """
+        return VirtualEventLoop(self)
+        
+    def run(self, coroutine):
+        """Run a coroutine to completion in virtual time.
+        
+        asyncio.sleep() and time.* calls inside the coroutine use this
+        clock, so a 30 second animation completes in milliseconds.
+        
+        Args:
+            coroutine: Awaitable to run
+        
+        Returns:
+            The coroutine's result
+        """
+        loop = self.new_event_loop()
+        try:
+            with self.patch():
+                return loop.run_until_complete(coroutine)
+        finally:
+            loop.close()
+
+
+class _VirtualSelector:
+    """Selector wrapper that turns idle waits into clock advances."""
+    
+    def __init__(self, clock):
+        self._clock = clock
+        self._selector = selectors.DefaultSelector()
+        
+    def select(self, timeout=None):
+        if timeout is None:
+            # No timers pending: only real I/O or another thread can
+            # wake the loop, so wait for it as usual
+            return self._selector.select(None)
+        # Never block on real time; I/O that is already ready is still
+        # delivered before jumping to the next timer
+        events = self._selector.select(0)
+        if not events and timeout > 0:
+            self._clock.advance(timeout)
+        return events
+        
+    def __getattr__(self, name):
+        return getattr(self._selector, name)
+
+
+class VirtualEventLoop(asyncio.SelectorEventLoop):
+    """Asyncio event loop whose timers run on a VirtualClock.
+    
+    When every task is waiting on a timer, the loop jumps straight to
+    the next deadline instead of sleeping, so concurrent tasks still
+    interleave exactly as they would in real time.
+    """
+    
+    def __init__(self, clock):
+        """Initialize virtual event loop.
+        
+        Args:
+            clock: VirtualClock that provides the loop's time
+        """
+        self.clock = clock
+        super().__init__(selector=_VirtualSelector(clock))
+        
+    def time(self):
+        """Loop time in seconds, taken from the virtual clock."""
+        return self.clock.monotonic()
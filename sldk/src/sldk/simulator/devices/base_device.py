@@ -1,7 +1,9 @@
 """Base class for LED matrix devices."""
 
+import os
 from abc import ABC, abstractmethod
-from ..core import LEDMatrix, DisplayManager
+from ..core import (LEDMatrix, DisplayManager, PerformanceManager,
+                    HeadlessDisplayManager, VirtualClock)
 from ..displayio import Display, FourWire
 
 
@@ -11,13 +13,19 @@ class BaseDevice(ABC):
     Provides common functionality for all simulated devices.
     """
     
-    def __init__(self, width, height, pitch=4.0):
+    def __init__(self, width, height, pitch=4.0, performance_manager=None,
+                 headless=None, clock=None):
         """Initialize base device.
         
         Args:
             width: Display width in pixels
             height: Display height in pixels
             pitch: LED pitch in mm
+            performance_manager: Optional PerformanceManager, or the name
+                of a hardware profile to create one for
+            headless: Render to numpy buffers only, driven by a virtual
+                clock. None reads the SLDK_HEADLESS environment variable.
+            clock: VirtualClock for headless mode (created if None)
         """
         self.width = width
         self.height = height
@@ -30,7 +38,15 @@ class BaseDevice(ABC):
         self.display_manager = None
         
         # Performance simulation (optional)
-        self.performance_manager = None
+        if isinstance(performance_manager, str):
+            performance_manager = PerformanceManager(performance_manager)
+        self.performance_manager = performance_manager
+        
+        # Headless mode (CI and batch rendering)
+        if headless is None:
+            headless = os.environ.get("SLDK_HEADLESS", "") not in ("", "0")
+        self.headless = headless
+        self.clock = clock or (VirtualClock() if headless else None)
         
     @abstractmethod
     def initialize(self):
@@ -68,15 +84,17 @@ class BaseDevice(ABC):
         if self.display:
             self.display.refresh()
             
-    def run(self, update_callback=None, title=None):
+    def run(self, update_callback=None, title=None, frames=None, duration=None):
         """Run the device simulation.
         
         Args:
             update_callback: Optional callback function called each frame
             title: Window title (defaults to device name)
+            frames: Headless only; stop after this many frames
+            duration: Headless only; stop after this many virtual seconds
         """
         if not self.display_manager:
-            self.display_manager = DisplayManager()
+            self.display_manager = self._create_display_manager()
             
         if not title:
             title = self.__class__.__name__
@@ -84,18 +102,54 @@ class BaseDevice(ABC):
         # Add display to manager
         self.display_manager.add_display(self.matrix)
         
+        if self.performance_manager:
+            update_callback = self._timed_callback(update_callback)
+            
         # Create window and run
         self.display_manager.create_window(title=title)
-        self.display_manager.run(update_callback)
+        if self.headless:
+            self.display_manager.run(update_callback, frames=frames, duration=duration)
+        else:
+            self.display_manager.run(update_callback)
+        
+    def _timed_callback(self, update_callback):
+        """Wrap a frame callback so each loop iteration is one simulated frame.
+        
+        Args:
+            update_callback: Frame callback or None
+            
+        Returns:
+            Callback that closes the previous frame and opens the next
+        """
+        performance_manager = self.performance_manager
+        
+        def frame():
+            if performance_manager.in_frame:
+                performance_manager.end_frame()
+            performance_manager.begin_frame()
+            if update_callback:
+                update_callback()
+                
+        return frame
         
     def run_once(self):
         """Run a single update cycle without entering main loop."""
         if not self.display_manager:
-            self.display_manager = DisplayManager()
+            self.display_manager = self._create_display_manager()
             self.display_manager.add_display(self.matrix)
             
         self.display_manager.run_once()
         
+    def _create_display_manager(self):
+        """Create the windowed or headless display manager.
+        
+        Returns:
+            DisplayManager or HeadlessDisplayManager
+        """
+        if self.headless:
+            return HeadlessDisplayManager(self.clock)
+        return DisplayManager()
+        
     def save_screenshot(self, filename):
         """Save a screenshot of the display.
         
@@ -11,7 +11,8 @@ class GenericMatrix(BaseDevice):
     Use this for non-standard matrix configurations.
     """
     
-    def __init__(self, width, height, pitch=4.0, led_size=None):
+    def __init__(self, width, height, pitch=4.0, led_size=None, performance_manager=None,
+                 headless=None, clock=None):
         """Initialize generic matrix.
         
         Args:
@@ -19,8 +20,12 @@ class GenericMatrix(BaseDevice):
             height: Display height in pixels
             pitch: LED pitch in mm (default 4.0)
             led_size: Optional custom LED size in pixels
+            performance_manager: Optional PerformanceManager or profile name
+            headless: Run without a window on a virtual clock
+                (None reads SLDK_HEADLESS)
+            clock: Optional VirtualClock for headless mode
         """
-        super().__init__(width, height, pitch)
+        super().__init__(width, height, pitch, performance_manager, headless, clock)
         self.led_size = led_size
         
     def initialize(self):
@@ -31,7 +36,8 @@ class GenericMatrix(BaseDevice):
             self.height,
             pitch=self.pitch,
             led_size=self.led_size,
-            performance_manager=self.performance_manager
+            performance_manager=self.performance_manager,
+            headless=self.headless
         )
         
         # Create display bus (stub for compatibility)
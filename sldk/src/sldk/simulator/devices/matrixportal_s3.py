@@ -11,15 +11,23 @@ class MatrixPortalS3(BaseDevice):
     Standard configuration with 64x32 RGB LED matrix.
     """
     
-    def __init__(self, pitch=3.0, width=64, height=32):
+    def __init__(self, pitch=3.0, width=64, height=32, performance_manager=None,
+                 headless=None, clock=None):
         """Initialize MatrixPortal S3.
         
         Args:
             pitch: LED pitch in mm (default 3.0 for 192x96mm physical size)
             width: Display width in pixels (default 64)
             height: Display height in pixels (default 32)
+            performance_manager: Optional PerformanceManager; pass True
+                to model this board's ESP32-S3 timing
+            headless: Run without a window on a virtual clock
+                (None reads SLDK_HEADLESS)
+            clock: Optional VirtualClock for headless mode
         """
-        super().__init__(width, height, pitch)
+        if performance_manager is True:
+            performance_manager = "ESP32-S3"
+        super().__init__(width, height, pitch, performance_manager, headless, clock)
         
         # Board-specific attributes
         self.NEOPIXEL = None  # Status NeoPixel (not simulated)
@@ -32,7 +40,8 @@ class MatrixPortalS3(BaseDevice):
             self.width, 
             self.height, 
             pitch=self.pitch,
-            performance_manager=self.performance_manager
+            performance_manager=self.performance_manager,
+            headless=self.headless
         )
         
         # Create display bus (stub for compatibility)
@@ -2,6 +2,8 @@
 
 import numpy as np
 
+from .versioning import next_stamp
+
 
 class Bitmap:
     """Bitmap for pixel data storage.
@@ -43,6 +45,9 @@ class Bitmap:
         # Create buffer to store pixel values
         self._buffer = np.zeros((height, width), dtype=dtype)
         
+        # Modification stamp for retained-mode rendering
+        self._stamp = next_stamp()
+        
     def __setitem__(self, index, value):
         """Set pixel value.
         
@@ -65,6 +70,7 @@ class Bitmap:
             raise ValueError(f"Pixel value {value} out of range")
             
         self._buffer[y, x] = value
+        self._stamp = next_stamp()
         
     def __getitem__(self, index):
         """Get pixel value.
@@ -98,6 +104,7 @@ class Bitmap:
             raise ValueError(f"Pixel value {value} out of range")
             
         self._buffer.fill(value)
+        self._stamp = next_stamp()
         
     def blit(self, x, y, source_bitmap, *, x1=0, y1=0, x2=None, y2=None, skip_index=None):
         """Copy pixels from another bitmap.
@@ -150,6 +157,18 @@ class Bitmap:
         else:
             # Copy all pixels
             self._buffer[y:y + copy_height, x:x + copy_width] = src_data
+        self._stamp = next_stamp()
+        
+    def dirty(self, x1=0, y1=0, x2=None, y2=None):
+        """Inform the display that the bitmap changed outside the API.
+        
+        Call this after writing to the underlying buffer directly.
+        
+        Args:
+            x1, y1: Top-left of the changed area (ignored; whole bitmap)
+            x2, y2: Bottom-right of the changed area (ignored; whole bitmap)
+        """
+        self._stamp = next_stamp()
             
     @property
     def bits_per_value(self):
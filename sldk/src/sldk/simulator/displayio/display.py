@@ -1,7 +1,9 @@
 """CircuitPython displayio.Display equivalent."""
 
+import numpy as np
+
 from ..core.led_matrix import LEDMatrix
-from ..core.color_utils import rgb565_to_rgb888
+from .versioning import next_stamp
 
 
 class Display:
@@ -48,6 +50,16 @@ class Display:
         self._matrix = LEDMatrix(width, height)
         self._matrix.set_brightness(brightness)
         
+        # Offscreen frame the scene is composed into before it is
+        # diffed against the matrix, and the scene state it shows
+        self._frame = np.zeros((height, width, 3), dtype=np.uint8)
+        self._frame_root = None
+        self._frame_stamp = None
+        
+        # Set while pixels are drawn straight onto the matrix (e.g. SLDK
+        # transition steps); refresh() then shows them instead of the scene
+        self.direct_drawing = False
+        
     @property
     def brightness(self):
         """Get display brightness."""
@@ -76,114 +88,196 @@ class Display:
     def refresh(self, *, target_frames_per_second=None, minimum_frames_per_second=1):
         """Manually refresh the display.
         
+        The scene is composed in retained mode. Every Group and TileGrid
+        keeps its last composited layer, and only subtrees whose
+        modification stamps moved are composed again. When nothing in
+        the scene changed, the previous frame is reused as is. Pixels
+        drawn on the matrix directly are replaced by the scene unless
+        direct_drawing is set.
+        
         Args:
             target_frames_per_second: Target refresh rate
             minimum_frames_per_second: Minimum acceptable refresh rate
         """
-        if self.root_group is None:
+        if self.direct_drawing:
+            # Compose the scene again once direct drawing is over
+            self._frame_root = None
+            self._matrix.render()
             return
             
-        # Clear the matrix
-        self._matrix.clear()
+        root = self.root_group
+        if root is None:
+            return
+            
+        if getattr(root, 'hidden', False):
+            stamp, layer = 0, None
+        else:
+            stamp, layer = self._layer(root, 1)
+        stamp = max(stamp, _stamp_of(root, '_place_stamp'))
         
-        # Render the root group
-        self._render_group(self.root_group, 0, 0, 1)
+        if root is not self._frame_root or stamp != self._frame_stamp:
+            # Compose the scene offscreen
+            self._frame.fill(0)
+            if layer is not None:
+                layer_x, layer_y, rgb, mask = layer
+                _paste(self._frame, int(getattr(root, 'x', 0)) + layer_x,
+                       int(getattr(root, 'y', 0)) + layer_y, rgb, mask)
+            self._frame_root = root
+            self._frame_stamp = stamp
+            
+            # Only pixels that differ from the last frame reach the matrix
+            self._matrix.load_frame(self._frame)
+        elif self._matrix.pixel_buffer.is_dirty():
+            # Something drew on the matrix directly; restore the scene
+            self._matrix.load_frame(self._frame)
         
         # Update the display
         self._matrix.render()
         
-    def _render_group(self, group, offset_x, offset_y, scale):
-        """Recursively render a group and its contents.
+    def capture(self, pixels):
+        """Read the frame on the matrix back into a pixel buffer.
+        
+        Not part of CircuitPython's API; SLDK displays use it to read
+        their content back. The scene is refreshed first, so the frame
+        is what the next show would put on screen.
         
         Args:
-            group: Group to render
-            offset_x: X offset from parent
-            offset_y: Y offset from parent
-            scale: Cumulative scale factor
+            pixels: Buffer of width * height entries, filled row by row
+                with 24-bit RGB colors
         """
-        if hasattr(group, 'hidden') and group.hidden:
-            return
+        self.refresh(minimum_frames_per_second=0)
+        rgb = self._matrix.pixel_buffer.get_buffer().astype(np.uint32)
+        packed = (rgb[:, :, 0] << 16) | (rgb[:, :, 1] << 8) | rgb[:, :, 2]
+        for i, color in enumerate(packed.ravel().tolist()):
+            pixels[i] = color
+        
+    def _layer(self, node, scale):
+        """Get the composited layer of a node in its own coordinates.
+        
+        Args:
+            node: Group or TileGrid
+            scale: Cumulative scale factor of the node's parent
             
-        # Calculate group position
-        group_x = offset_x + (group.x if hasattr(group, 'x') else 0) * scale
-        group_y = offset_y + (group.y if hasattr(group, 'y') else 0) * scale
-        group_scale = scale * (group.scale if hasattr(group, 'scale') else 1)
-        
-        # Check if this is a Group with items
-        if hasattr(group, '_items'):
-            # Render all items in the group
-            for item in group._items:
-                self._render_group(item, group_x, group_y, group_scale)
-        # Check if this is a TileGrid
-        elif hasattr(group, 'bitmap') and hasattr(group, 'pixel_shader'):
-            self._render_tilegrid(group, group_x, group_y, group_scale)
-        # Check if this is a Label (from adafruit_display_text)
-        elif hasattr(group, '_bitmap') and hasattr(group, 'color'):
-            self._render_label(group, group_x, group_y, group_scale)
+        Returns:
+            Tuple of (stamp, layer). stamp is the newest modification in
+            the subtree; layer is None when nothing is drawn, otherwise
+            (x, y, rgb, mask) relative to the node's position
+        """
+        if hasattr(node, '_items'):
+            return self._group_layer(node, scale)
+        if hasattr(node, 'bitmap') and hasattr(node, 'pixel_shader'):
+            return self._tilegrid_layer(node, scale)
+        return _stamp_of(node, '_stamp'), None
+        
+    def _group_layer(self, group, scale):
+        """Composite a Group's visible children, reusing the cached result.
+        
+        Args:
+            group: Group to composite
+            scale: Cumulative scale factor of the group's parent
+            
+        Returns:
+            Tuple of (stamp, layer) as for _layer()
+        """
+        group_scale = scale * getattr(group, 'scale', 1)
+        stamp = _stamp_of(group, '_stamp')
+        
+        placed = []
+        for item in group._items:
+            stamp = max(stamp, _stamp_of(item, '_place_stamp'))
+            if getattr(item, 'hidden', False):
+                continue
+            item_stamp, item_layer = self._layer(item, group_scale)
+            stamp = max(stamp, item_stamp)
+            if item_layer is not None:
+                item_x, item_y, rgb, mask = item_layer
+                placed.append((int(getattr(item, 'x', 0) * group_scale) + item_x,
+                               int(getattr(item, 'y', 0) * group_scale) + item_y,
+                               rgb, mask))
+                
+        cache = getattr(group, '_layer_cache', None)
+        if cache is not None and cache[0] == group_scale and cache[1] == stamp:
+            return stamp, cache[2]
+            
+        if not placed:
+            layer = None
+        elif len(placed) == 1:
+            layer = placed[0]
+        else:
+            # Union of the children's boxes, painted in order
+            x1 = min(p[0] for p in placed)
+            y1 = min(p[1] for p in placed)
+            x2 = max(p[0] + p[3].shape[1] for p in placed)
+            y2 = max(p[1] + p[3].shape[0] for p in placed)
+            rgb = np.zeros((y2 - y1, x2 - x1, 3), dtype=np.uint8)
+            mask = np.zeros((y2 - y1, x2 - x1), dtype=bool)
+            for item_x, item_y, item_rgb, item_mask in placed:
+                _paste(rgb, item_x - x1, item_y - y1, item_rgb, item_mask, mask)
+            layer = (x1, y1, rgb, mask)
             
-    def _render_tilegrid(self, tilegrid, x, y, scale):
-        """Render a TileGrid to the display.
+        group._layer_cache = (group_scale, stamp, layer)
+        return stamp, layer
+        
+    def _tilegrid_layer(self, tilegrid, scale):
+        """Rasterize a TileGrid, reusing the cached result.
+        
+        The grid is resolved as a whole: tiles are assembled from the
+        bitmap's index buffer, scaled with np.repeat and colored through
+        the palette lookup table, with the palette's opacity as the mask.
         
         Args:
-            tilegrid: TileGrid to render
-            x: X position
-            y: Y position
-            scale: Scale factor
+            tilegrid: TileGrid to rasterize
+            scale: Cumulative scale factor
+            
+        Returns:
+            Tuple of (stamp, layer) as for _layer()
         """
-        if tilegrid.hidden:
-            return
+        stamp = max(_stamp_of(tilegrid, '_stamp'),
+                    _stamp_of(tilegrid.bitmap, '_stamp'),
+                    _stamp_of(tilegrid.pixel_shader, '_stamp'))
+        
+        cache = getattr(tilegrid, '_layer_cache', None)
+        if cache is not None and cache[0] == scale and cache[1] == stamp:
+            return stamp, cache[2]
             
-        # Get bitmap and palette
-        bitmap = tilegrid.bitmap
-        palette = tilegrid.pixel_shader
-        
-        # Render each tile
-        for tile_y in range(tilegrid.height):
-            for tile_x in range(tilegrid.width):
-                tile_index = tilegrid[tile_x, tile_y]
-                
-                # Calculate tile source position
-                src_tile_x = (tile_index % tilegrid._tiles_per_row) * tilegrid.tile_width
-                src_tile_y = (tile_index // tilegrid._tiles_per_row) * tilegrid.tile_height
-                
-                # Calculate destination position
-                dst_x = x + tile_x * tilegrid.tile_width * scale
-                dst_y = y + tile_y * tilegrid.tile_height * scale
+        colors, opaque = self._lookup_tables(tilegrid.pixel_shader)
+        if len(colors) == 0:
+            layer = None
+        else:
+            indices = tilegrid.index_image()
+            
+            # Apply integer scaling
+            if scale > 1:
+                indices = np.repeat(np.repeat(indices, scale, axis=0), scale, axis=1)
                 
-                # Render tile pixels
-                for py in range(tilegrid.tile_height):
-                    for px in range(tilegrid.tile_width):
-                        # Get pixel from bitmap
-                        pixel_value = bitmap[src_tile_x + px, src_tile_y + py]
-                        
-                        # Skip transparent pixels
-                        if palette.is_transparent(pixel_value):
-                            continue
-                            
-                        # Get color from palette
-                        color = palette.get_rgb888(pixel_value)
-                        
-                        # Apply scaling
-                        for sy in range(scale):
-                            for sx in range(scale):
-                                pixel_x = int(dst_x + px * scale + sx)
-                                pixel_y = int(dst_y + py * scale + sy)
-                                
-                                # Set pixel if within bounds
-                                if 0 <= pixel_x < self.width and 0 <= pixel_y < self.height:
-                                    self._matrix.set_pixel(pixel_x, pixel_y, color)
-                                    
-    def _render_label(self, label, x, y, scale):
-        """Render a Label to the display.
+            # Palette gather; opacity becomes the layer mask
+            rgb = np.take(colors, indices, axis=0, mode='clip')
+            mask = np.take(opaque, indices, mode='clip')
+            layer = (0, 0, rgb, mask)
+            
+        tilegrid._layer_cache = (scale, stamp, layer)
+        return stamp, layer
+        
+    @staticmethod
+    def _lookup_tables(pixel_shader):
+        """Get (colors, opaque) lookup arrays for a pixel shader.
         
         Args:
-            label: Label to render
-            x: X position
-            y: Y position
-            scale: Scale factor
+            pixel_shader: Palette or palette-like object
+            
+        Returns:
+            Tuple of (n, 3) uint8 colors and (n,) bool opacity
         """
-        # Labels are Groups that contain a TileGrid, so render them as groups
-        self._render_group(label, x, y, scale)
+        if hasattr(pixel_shader, 'lookup_tables'):
+            return pixel_shader.lookup_tables()
+            
+        # Generic fallback for shaders without cached tables
+        count = len(pixel_shader)
+        colors = np.array([pixel_shader.get_rgb888(i) for i in range(count)],
+                          dtype=np.uint8).reshape(-1, 3)
+        opaque = np.array([not pixel_shader.is_transparent(i) for i in range(count)],
+                          dtype=bool)
+        return colors, opaque
         
     def get_matrix(self):
         """Get the underlying LED matrix.
@@ -191,4 +285,45 @@ class Display:
         Returns:
             LEDMatrix instance
         """
-        return self._matrix
\ No newline at end of file
+        return self._matrix
+
+
+def _stamp_of(obj, attr):
+    """Get a modification stamp, treating untracked objects as changed.
+    
+    Args:
+        obj: Display object
+        attr: '_stamp' or '_place_stamp'
+        
+    Returns:
+        Integer stamp
+    """
+    stamp = getattr(obj, attr, None)
+    return next_stamp() if stamp is None else stamp
+
+
+def _paste(target, x, y, rgb, mask, target_mask=None):
+    """Copy the masked pixels of a layer into a target array, clipped.
+    
+    Args:
+        target: Destination (height, width, 3) array
+        x: Destination X of the layer's left edge
+        y: Destination Y of the layer's top edge
+        rgb: Layer colors (h, w, 3)
+        mask: Layer coverage (h, w)
+        target_mask: Optional coverage array of the target to update
+    """
+    src_x = max(0, -x)
+    src_y = max(0, -y)
+    dst_x = max(0, x)
+    dst_y = max(0, y)
+    copy_width = min(rgb.shape[1] - src_x, target.shape[1] - dst_x)
+    copy_height = min(rgb.shape[0] - src_y, target.shape[0] - dst_y)
+    if copy_width <= 0 or copy_height <= 0:
+        return
+        
+    src = (slice(src_y, src_y + copy_height), slice(src_x, src_x + copy_width))
+    dst = (slice(dst_y, dst_y + copy_height), slice(dst_x, dst_x + copy_width))
+    np.copyto(target[dst], rgb[src], where=mask[src][:, :, None])
+    if target_mask is not None:
+        target_mask[dst] |= mask[src]
@@ -1,5 +1,7 @@
 """CircuitPython displayio.Group equivalent."""
 
+from .versioning import next_stamp
+
 
 class Group:
     """Group organizes display elements into a tree structure.
@@ -17,12 +19,69 @@ class Group:
             x: X position of group (default 0)
             y: Y position of group (default 0)
         """
-        self.scale = scale
-        self.x = x
-        self.y = y
-        self.hidden = False
         self._items = []
         
+        # Retained-mode bookkeeping: _stamp covers the group's contents,
+        # _place_stamp its position/visibility within the parent, and
+        # the Display keeps the composited subtree in _layer_cache
+        self._stamp = next_stamp()
+        self._place_stamp = self._stamp
+        self._layer_cache = None
+        
+        self._scale = scale
+        self._x = x
+        self._y = y
+        self._hidden = False
+        
+    @property
+    def x(self):
+        """Get X position of group."""
+        return self._x
+        
+    @x.setter
+    def x(self, value):
+        """Set X position of group."""
+        if value != self._x:
+            self._x = value
+            self._place_stamp = next_stamp()
+            
+    @property
+    def y(self):
+        """Get Y position of group."""
+        return self._y
+        
+    @y.setter
+    def y(self, value):
+        """Set Y position of group."""
+        if value != self._y:
+            self._y = value
+            self._place_stamp = next_stamp()
+            
+    @property
+    def hidden(self):
+        """Get whether the group is hidden."""
+        return self._hidden
+        
+    @hidden.setter
+    def hidden(self, value):
+        """Set whether the group is hidden."""
+        value = bool(value)
+        if value != self._hidden:
+            self._hidden = value
+            self._place_stamp = next_stamp()
+            
+    @property
+    def scale(self):
+        """Get integer scale factor of group."""
+        return self._scale
+        
+    @scale.setter
+    def scale(self, value):
+        """Set integer scale factor of group."""
+        if value != self._scale:
+            self._scale = value
+            self._stamp = next_stamp()
+        
     def append(self, item):
         """Add an item to the group.
         
@@ -32,6 +91,7 @@ class Group:
         if item in self._items:
             raise ValueError("Item already in group")
         self._items.append(item)
+        self._stamp = next_stamp()
         
     def insert(self, index, item):
         """Insert an item at a specific position.
@@ -43,6 +103,7 @@ class Group:
         if item in self._items:
             raise ValueError("Item already in group")
         self._items.insert(index, item)
+        self._stamp = next_stamp()
         
     def remove(self, item):
         """Remove an item from the group.
@@ -51,6 +112,7 @@ class Group:
             item: Display object to remove
         """
         self._items.remove(item)
+        self._stamp = next_stamp()
         
     def pop(self, index=-1):
         """Remove and return an item.
@@ -61,7 +123,9 @@ class Group:
         Returns:
             Removed display object
         """
-        return self._items.pop(index)
+        item = self._items.pop(index)
+        self._stamp = next_stamp()
+        return item
         
     def index(self, item):
         """Find the index of an item.
@@ -100,6 +164,7 @@ class Group:
         if item in self._items:
             self._items.remove(item)
         self._items[index] = item
+        self._stamp = next_stamp()
         
     def __iter__(self):
         """Iterate over items in group."""
@@ -112,6 +177,7 @@ class Group:
             key: Optional key function for sorting
         """
         self._items.sort(key=key)
+        self._stamp = next_stamp()
         
     @property
     def auto_write(self):
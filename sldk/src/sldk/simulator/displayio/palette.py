@@ -1,6 +1,9 @@
 """CircuitPython displayio.Palette equivalent."""
 
+import numpy as np
+
 from ..core.color_utils import rgb565_to_rgb888, rgb888_to_rgb565
+from .versioning import next_stamp
 
 
 class Palette:
@@ -19,6 +22,10 @@ class Palette:
         self._color_count = color_count
         self._colors = [None] * color_count
         self._transparent = [False] * color_count
+        # Lookup tables for the compositor, rebuilt lazily after changes
+        self._lut = None
+        # Modification stamp for retained-mode rendering
+        self._stamp = next_stamp()
         
     def __len__(self):
         """Get number of colors in palette."""
@@ -51,6 +58,7 @@ class Palette:
             else:
                 # It's already RGB565
                 self._colors[index] = color & 0xFFFF
+        self._changed()
             
     def __getitem__(self, index):
         """Get a color from the palette.
@@ -77,6 +85,7 @@ class Palette:
             raise IndexError(f"Palette index {index} out of range")
             
         self._transparent[index] = True
+        self._changed()
         
     def make_opaque(self, index):
         """Make a palette entry opaque.
@@ -88,6 +97,7 @@ class Palette:
             raise IndexError(f"Palette index {index} out of range")
             
         self._transparent[index] = False
+        self._changed()
         
     def is_transparent(self, index):
         """Check if a palette entry is transparent.
@@ -113,4 +123,25 @@ class Palette:
             (r, g, b) tuple in 0-255 range
         """
         color565 = self[index]
-        return rgb565_to_rgb888(color565)
\ No newline at end of file
+        return rgb565_to_rgb888(color565)
+        
+    def _changed(self):
+        """Drop cached lookup tables and record a modification."""
+        self._lut = None
+        self._stamp = next_stamp()
+        
+    def lookup_tables(self):
+        """Get the palette as arrays for vectorized color lookup.
+        
+        Returns:
+            Tuple of (colors, opaque) where colors is a (n, 3) uint8 array
+            of RGB888 values and opaque is a (n,) bool array
+        """
+        if self._lut is None:
+            colors = np.array(
+                [rgb565_to_rgb888(0 if c is None else c) for c in self._colors],
+                dtype=np.uint8
+            ).reshape(-1, 3)
+            opaque = ~np.array(self._transparent, dtype=bool)
+            self._lut = (colors, opaque)
+        return self._lut
@@ -1,5 +1,9 @@
 """CircuitPython displayio.TileGrid equivalent."""
 
+import numpy as np
+
+from .versioning import next_stamp
+
 
 class TileGrid:
     """TileGrid arranges bitmap tiles on screen.
@@ -24,8 +28,14 @@ class TileGrid:
             x: X position of grid (default 0)
             y: Y position of grid (default 0)
         """
-        self.bitmap = bitmap
-        self.pixel_shader = pixel_shader
+        # Retained-mode bookkeeping: _stamp covers what the grid shows,
+        # _place_stamp its position/visibility within the parent
+        self._stamp = next_stamp()
+        self._place_stamp = self._stamp
+        self._layer_cache = None
+        
+        self._bitmap = bitmap
+        self._pixel_shader = pixel_shader
         self.width = width
         self.height = height
         
@@ -44,12 +54,12 @@ class TileGrid:
         self._tiles_per_row = bitmap.width // self.tile_width
         
         # Initialize tile indices
-        self._tiles = [[default_tile for _ in range(width)] for _ in range(height)]
+        self._tiles = np.full((height, width), default_tile, dtype=np.int32)
         
         # Position and visibility
-        self.x = x
-        self.y = y
-        self.hidden = False
+        self._x = x
+        self._y = y
+        self._hidden = False
         self._transpose_xy = False
         self._flip_x = False
         self._flip_y = False
@@ -72,7 +82,8 @@ class TileGrid:
             if not (0 <= index < self.width * self.height):
                 raise IndexError(f"Tile index {index} out of bounds")
                 
-        self._tiles[y][x] = tile_index
+        self._tiles[y, x] = tile_index
+        self._stamp = next_stamp()
         
     def __getitem__(self, index):
         """Get tile at given position.
@@ -94,8 +105,67 @@ class TileGrid:
             if not (0 <= index < self.width * self.height):
                 raise IndexError(f"Tile index {index} out of bounds")
                 
-        return self._tiles[y][x]
+        return int(self._tiles[y, x])
+        
+    @property
+    def bitmap(self):
+        """Get the source bitmap."""
+        return self._bitmap
+        
+    @bitmap.setter
+    def bitmap(self, value):
+        """Set the source bitmap."""
+        self._bitmap = value
+        self._stamp = next_stamp()
+        
+    @property
+    def pixel_shader(self):
+        """Get the palette used for coloring."""
+        return self._pixel_shader
+        
+    @pixel_shader.setter
+    def pixel_shader(self, value):
+        """Set the palette used for coloring."""
+        self._pixel_shader = value
+        self._stamp = next_stamp()
+        
+    @property
+    def x(self):
+        """Get X position of grid."""
+        return self._x
+        
+    @x.setter
+    def x(self, value):
+        """Set X position of grid."""
+        if value != self._x:
+            self._x = value
+            self._place_stamp = next_stamp()
+            
+    @property
+    def y(self):
+        """Get Y position of grid."""
+        return self._y
         
+    @y.setter
+    def y(self, value):
+        """Set Y position of grid."""
+        if value != self._y:
+            self._y = value
+            self._place_stamp = next_stamp()
+            
+    @property
+    def hidden(self):
+        """Get whether the grid is hidden."""
+        return self._hidden
+        
+    @hidden.setter
+    def hidden(self, value):
+        """Set whether the grid is hidden."""
+        value = bool(value)
+        if value != self._hidden:
+            self._hidden = value
+            self._place_stamp = next_stamp()
+            
     @property
     def transpose_xy(self):
         """Get transpose_xy setting."""
@@ -105,6 +175,7 @@ class TileGrid:
     def transpose_xy(self, value):
         """Set whether to swap x and y coordinates."""
         self._transpose_xy = bool(value)
+        self._stamp = next_stamp()
         
     @property
     def flip_x(self):
@@ -115,6 +186,7 @@ class TileGrid:
     def flip_x(self, value):
         """Set whether to flip horizontally."""
         self._flip_x = bool(value)
+        self._stamp = next_stamp()
         
     @property
     def flip_y(self):
@@ -125,6 +197,7 @@ class TileGrid:
     def flip_y(self, value):
         """Set whether to flip vertically."""
         self._flip_y = bool(value)
+        self._stamp = next_stamp()
         
     def get_tile_bitmap(self, tile_index):
         """Get bitmap data for a specific tile.
@@ -143,6 +216,45 @@ class TileGrid:
         # (In actual implementation, this would return a view of the bitmap data)
         return (tile_x, tile_y, self.tile_width, self.tile_height)
         
+    def index_image(self):
+        """Assemble the palette indices of the whole grid as one array.
+        
+        Tiles are gathered from the bitmap with array slicing, and
+        flip_x/flip_y/transpose_xy are applied to the assembled grid the
+        way CircuitPython renders them.
+        
+        Returns:
+            Numpy array of shape (pixel_height, pixel_width), or
+            (pixel_width, pixel_height) when transposed
+        """
+        source = self._bitmap._buffer
+        tile_width = self.tile_width
+        tile_height = self.tile_height
+        
+        if self.width == 1 and self.height == 1:
+            # Single tile (the common label/sprite case) is a plain view
+            tile_index = int(self._tiles[0, 0])
+            tile_x = (tile_index % self._tiles_per_row) * tile_width
+            tile_y = (tile_index // self._tiles_per_row) * tile_height
+            image = source[tile_y:tile_y + tile_height, tile_x:tile_x + tile_width]
+        else:
+            # Cut the bitmap into a (tile, row, col) stack and gather
+            tile_rows = source.shape[0] // tile_height
+            tiles = source[:tile_rows * tile_height, :self._tiles_per_row * tile_width]
+            tiles = tiles.reshape(tile_rows, tile_height, self._tiles_per_row, tile_width)
+            tiles = tiles.swapaxes(1, 2).reshape(-1, tile_height, tile_width)
+            image = tiles[self._tiles]
+            image = image.swapaxes(1, 2).reshape(
+                self.height * tile_height, self.width * tile_width)
+            
+        if self._flip_x:
+            image = image[:, ::-1]
+        if self._flip_y:
+            image = image[::-1, :]
+        if self._transpose_xy:
+            image = image.T
+        return image
+        
     @property
     def pixel_width(self):
         """Get total width in pixels."""
@@ -0,0 +1,19 @@
+"""Modification stamps for retained-mode rendering.
+
+Every displayio object records the stamp of its last change. Stamps come
+from one process-wide counter, so the newest stamp anywhere in a subtree
+tells the Display whether its cached composite of that subtree is stale.
+"""
+
+import itertools
+
+_counter = itertools.count(1)
+
+
+def next_stamp():
+    """Get a new, strictly increasing modification stamp.
+    
+    Returns:
+        Integer stamp greater than every stamp handed out before
+    """
+    return next(_counter)
@@ -0,0 +1,12 @@
+"""CircuitPython terminalio compatibility layer.
+
+The built-in terminal font is stood in for by viii.bdf from the
+package fonts directory.
+"""
+
+from ..adafruit_bitmap_font import bitmap_font
+
+# load_font() finds bare names in the package fonts directory
+FONT = bitmap_font.load_font('viii.bdf')
+
+__all__ = ['FONT']
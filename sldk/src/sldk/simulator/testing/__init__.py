@@ -0,0 +1,7 @@
+"""Regression testing helpers for the simulator."""
+
+from .golden import (FrameSet, FrameDiff, FrameRecorder, assert_golden,
+                     color_distance, compare_frames)
+
+__all__ = ['FrameSet', 'FrameDiff', 'FrameRecorder', 'assert_golden',
+           'color_distance', 'compare_frames']
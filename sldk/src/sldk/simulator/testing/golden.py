@@ -0,0 +1,273 @@
+"""Golden-frame capture and comparison for simulator regression tests.
+
+Frames are captured from an LEDMatrix pixel buffer at virtual-clock
+timestamps and stored as one palette plus a run-length encoding of
+palette indices across all frames. LED content is mostly flat color,
+so a scripted run of hundreds of frames packs into a few kilobytes.
+"""
+
+import asyncio
+import os
+import time
+
+import numpy as np
+
+
+# Environment variable that makes assert_golden() rewrite its files
+UPDATE_ENV = "SLDK_UPDATE_GOLDEN"
+
+
+class FrameSet:
+    """Ordered list of (timestamp, frame) pairs for one scenario."""
+    
+    def __init__(self):
+        """Initialize an empty frame set."""
+        self.timestamps = []
+        self.frames = []
+        
+    def __len__(self):
+        return len(self.frames)
+        
+    def add(self, timestamp, frame):
+        """Append a frame.
+        
+        Args:
+            timestamp: Virtual time of the capture in seconds
+            frame: Numpy array of shape (height, width, 3), dtype uint8
+        """
+        self.timestamps.append(round(float(timestamp), 6))
+        self.frames.append(np.array(frame, dtype=np.uint8, copy=True))
+        
+    def encode(self):
+        """Pack the frames into palette + RLE arrays.
+        
+        Returns:
+            Dict of numpy arrays suitable for np.savez_compressed
+        """
+        if not self.frames:
+            raise ValueError("No frames to encode")
+        
+        stack = np.stack(self.frames).astype(np.uint32)
+        packed = (stack[..., 0] << 16) | (stack[..., 1] << 8) | stack[..., 2]
+        palette, indices = np.unique(packed.ravel(), return_inverse=True)
+        
+        # One run per change of palette index across the whole stack
+        starts = np.concatenate(([0], np.flatnonzero(np.diff(indices)) + 1))
+        lengths = np.diff(np.append(starts, indices.size))
+        index_dtype = np.uint16 if palette.size <= 0xFFFF else np.uint32
+        
+        return {
+            "shape": np.array(stack.shape[:3], dtype=np.int32),
+            "timestamps": np.array(self.timestamps, dtype=np.float64),
+            "palette": palette.astype(np.uint32),
+            "values": indices[starts].astype(index_dtype),
+            "lengths": lengths.astype(np.uint32),
+        }
+        
+    @classmethod
+    def decode(cls, arrays):
+        """Rebuild a frame set from encode() output.
+        
+        Args:
+            arrays: Mapping with the keys produced by encode()
+        
+        Returns:
+            FrameSet instance
+        """
+        count, height, width = (int(n) for n in arrays["shape"])
+        packed = np.repeat(arrays["palette"][arrays["values"]], arrays["lengths"])
+        packed = packed.reshape(count, height, width)
+        
+        rgb = np.empty((count, height, width, 3), dtype=np.uint8)
+        rgb[..., 0] = (packed >> 16) & 0xFF
+        rgb[..., 1] = (packed >> 8) & 0xFF
+        rgb[..., 2] = packed & 0xFF
+        
+        frame_set = cls()
+        frame_set.timestamps = [float(t) for t in arrays["timestamps"]]
+        frame_set.frames = list(rgb)
+        return frame_set
+        
+    def save(self, path):
+        """Write the frame set to a compressed .npz file.
+        
+        Args:
+            path: Destination path
+        """
+        directory = os.path.dirname(path)
+        if directory:
+            os.makedirs(directory, exist_ok=True)
+        with open(path, "wb") as f:
+            np.savez_compressed(f, **self.encode())
+        
+    @classmethod
+    def load(cls, path):
+        """Read a frame set written by save().
+        
+        Args:
+            path: Source path
+        
+        Returns:
+            FrameSet instance
+        """
+        with np.load(path) as arrays:
+            return cls.decode(arrays)
+
+
+class FrameDiff:
+    """Result of comparing two frames."""
+    
+    def __init__(self, bad_pixels, max_distance, bbox):
+        """Initialize frame diff.
+        
+        Args:
+            bad_pixels: Number of pixels beyond tolerance
+            max_distance: Largest perceptual distance seen
+            bbox: (x1, y1, x2, y2) inclusive bounds of bad pixels, or None
+        """
+        self.bad_pixels = bad_pixels
+        self.max_distance = max_distance
+        self.bbox = bbox
+        
+    def __repr__(self):
+        return (f"FrameDiff(bad_pixels={self.bad_pixels}, "
+                f"max_distance={self.max_distance:.1f}, bbox={self.bbox})")
+
+
+def color_distance(expected, actual):
+    """Perceptual distance between two RGB images.
+    
+    Uses the "redmean" weighted Euclidean approximation, which tracks
+    perceived difference far better than plain RGB distance at almost
+    no extra cost. Identical pixels are 0, black vs white is about 765.
+    
+    Args:
+        expected: Array of shape (..., 3)
+        actual: Array of the same shape
+    
+    Returns:
+        Float32 array of shape (...)
+    """
+    a = expected.astype(np.float32)
+    b = actual.astype(np.float32)
+    red_mean = (a[..., 0] + b[..., 0]) * 0.5
+    delta = a - b
+    return np.sqrt((2 + red_mean / 256) * delta[..., 0] ** 2
+                   + 4 * delta[..., 1] ** 2
+                   + (2 + (255 - red_mean) / 256) * delta[..., 2] ** 2)
+
+
+def compare_frames(expected, actual, tolerance=24.0):
+    """Compare two frames with a perceptual tolerance.
+    
+    Args:
+        expected: Reference frame (height, width, 3)
+        actual: Frame under test, same shape
+        tolerance: Largest color_distance() still counted as equal
+    
+    Returns:
+        FrameDiff
+    """
+    if expected.shape != actual.shape:
+        raise ValueError(f"Frame shape {actual.shape} != expected {expected.shape}")
+    
+    distance = color_distance(expected, actual)
+    bad = distance > tolerance
+    bad_pixels = int(np.count_nonzero(bad))
+    bbox = None
+    if bad_pixels:
+        rows = np.flatnonzero(bad.any(axis=1))
+        cols = np.flatnonzero(bad.any(axis=0))
+        bbox = (int(cols[0]), int(rows[0]), int(cols[-1]), int(rows[-1]))
+    return FrameDiff(bad_pixels, float(distance.max()), bbox)
+
+
+def assert_golden(frame_set, path, tolerance=24.0, max_bad_pixels=0):
+    """Check captured frames against a golden file.
+    
+    The golden file is only written, instead of compared, when
+    SLDK_UPDATE_GOLDEN is set. A missing golden file fails, so a test
+    whose file was never committed can't pass by recording it. On a
+    mismatch the actual frames are written next to it as
+    <name>.actual.npz.
+    
+    Args:
+        frame_set: FrameSet captured by the test
+        path: Golden .npz path
+        tolerance: Per-pixel perceptual tolerance (see compare_frames)
+        max_bad_pixels: Pixels per frame allowed beyond tolerance
+    
+    Returns:
+        True if compared, False if the golden file was (re)recorded
+    
+    Raises:
+        AssertionError: If the golden file is missing, any frame differs
+            or the timestamps changed
+    """
+    if os.environ.get(UPDATE_ENV):
+        frame_set.save(path)
+        return False
+    if not os.path.exists(path):
+        raise AssertionError(f"Golden file {path} is missing; run with {UPDATE_ENV}=1 to record it")
+    
+    expected = FrameSet.load(path)
+    failures = []
+    if expected.timestamps != frame_set.timestamps:
+        failures.append(f"timestamps {frame_set.timestamps} != expected {expected.timestamps}")
+    else:
+        for timestamp, want, got in zip(expected.timestamps, expected.frames, frame_set.frames):
+            diff = compare_frames(want, got, tolerance)
+            if diff.bad_pixels > max_bad_pixels:
+                failures.append(f"t={timestamp:g}s: {diff}")
+    
+    if failures:
+        actual_path = os.path.splitext(path)[0] + ".actual.npz"
+        frame_set.save(actual_path)
+        raise AssertionError(
+            f"{len(failures)} frame(s) differ from {path} (actual saved to {actual_path}):\n  "
+            + "\n  ".join(failures))
+    return True
+
+
+class FrameRecorder:
+    """Captures an LEDMatrix pixel buffer at chosen virtual times."""
+    
+    def __init__(self, matrix, clock=None):
+        """Initialize frame recorder.
+        
+        Args:
+            matrix: LEDMatrix whose pixel buffer is captured
+            clock: VirtualClock used for timestamps (time.monotonic if None)
+        """
+        self.matrix = matrix
+        self.clock = clock
+        self.frame_set = FrameSet()
+        
+    def now(self):
+        """Current time on the recorder's clock."""
+        return self.clock.monotonic() if self.clock else time.monotonic()
+        
+    def capture(self, timestamp=None):
+        """Capture the current pixel buffer.
+        
+        Args:
+            timestamp: Time to record (defaults to now())
+        """
+        if timestamp is None:
+            timestamp = self.now()
+        self.frame_set.add(timestamp, self.matrix.get_frame())
+        
+    async def capture_at(self, timestamps):
+        """Capture at each timestamp; run alongside the scripted scenario.
+        
+        Under VirtualClock.run() the sleeps land exactly on the requested
+        times, so captures are reproducible.
+        
+        Args:
+            timestamps: Iterable of times in seconds on the recorder's clock
+        """
+        for timestamp in sorted(timestamps):
+            delay = timestamp - self.now()
+            if delay > 0:
+                await asyncio.sleep(delay)
+            self.capture(timestamp)
@@ -38,6 +38,16 @@ class TestSLDKApp:
         
         assert app.update_interval == 30
     
+    def test_next_update_interval_jitter(self, mock_circuitpython_imports):
+        """Test that update waits are jittered within the configured fraction."""
+        app = SLDKApp(update_interval=100, enable_web=False)
+        assert app.next_update_interval() == 100
+        
+        app = SLDKApp(update_interval=100, update_jitter=0.1, enable_web=False)
+        delays = [app.next_update_interval() for _ in range(50)]
+        assert all(90 <= delay <= 110 for delay in delays)
+        assert len(set(delays)) > 1
+    
     @pytest.mark.asyncio
     async def test_create_display_default(self, mock_circuitpython_imports):
         """Test default display creation."""
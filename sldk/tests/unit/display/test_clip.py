@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""Unit tests for pre-baked animation clips."""
+
+import io
+import pytest
+
+from sldk.display.strategy import get_strategy_registry
+from sldk.display.timeline import Timeline
+from sldk.display.clip import (
+    ClipWriter, ClipReader, ClipBaker, ClipStrategy, FRAME_KEY, FRAME_DELTA,
+    HEADER_SIZE, FRAME_HEADER_SIZE
+)
+from tests.unit.fakes import FakeClock, FrameDisplay
+
+
+def moving_dot_frames(count, width=8, height=4):
+    """Frames of a red dot crossing a striped background."""
+    background = [0x0000FF if i % 2 else 0x00FF00 for i in range(width * height)]
+    frames = []
+    for n in range(count):
+        frame = list(background)
+        frame[n % (width * height)] = 0xFF0000
+        frames.append(frame)
+    return frames
+
+
+def frame_kinds(data):
+    """Read the kind of each frame in an encoded clip."""
+    reader = ClipReader(io.BytesIO(data))
+    offset = HEADER_SIZE + len(reader.palette) * 3
+    kinds = []
+    for _ in range(reader.frame_count):
+        kinds.append(data[offset])
+        length = int.from_bytes(data[offset + 1:offset + 5], 'little')
+        offset += FRAME_HEADER_SIZE + length
+    return kinds
+
+
+class TestClipFormat:
+    """Test cases for encoding and decoding clips."""
+    
+    @pytest.mark.asyncio
+    async def test_round_trip(self):
+        """Test that every decoded frame matches the frame written."""
+        frames = moving_dot_frames(6)
+        writer = ClipWriter(8, 4, fps=10)
+        for frame in frames:
+            writer.add_frame(frame)
+        
+        reader = ClipReader(io.BytesIO(writer.to_bytes()))
+        assert (reader.width, reader.height, reader.frame_count, reader.fps) == (8, 4, 6, 10)
+        assert reader.duration == pytest.approx(0.6)
+        
+        display = FrameDisplay()
+        for frame in frames:
+            assert await reader.draw_next(display)
+            assert list(display.pixels) == frame
+        assert not await reader.draw_next(display)
+    
+    @pytest.mark.asyncio
+    async def test_deltas_touch_only_changed_pixels(self):
+        """Test that frames after the first carry just their changes."""
+        writer = ClipWriter(8, 4)
+        for frame in moving_dot_frames(3):
+            writer.add_frame(frame)
+        writer.add_frame(moving_dot_frames(3)[2])
+        data = writer.to_bytes()
+        
+        assert frame_kinds(data) == [FRAME_KEY, FRAME_DELTA, FRAME_DELTA, FRAME_DELTA]
+        
+        reader = ClipReader(io.BytesIO(data))
+        display = FrameDisplay()
+        await reader.draw_next(display)
+        assert display.writes == 32
+        await reader.draw_next(display)
+        # The dot leaves one pixel and lands on the next
+        assert display.writes == 34
+        await reader.draw_next(display)
+        await reader.draw_next(display)
+        # An unchanged frame writes nothing
+        assert display.writes == 36
+    
+    @pytest.mark.asyncio
+    async def test_long_runs_and_gaps(self):
+        """Test runs past 255 pixels and gaps past 65535 on a large frame."""
+        width, height = 300, 240
+        first = [0x000000] * (width * height)
+        second = list(first)
+        second[0] = 0xFFFFFF
+        second[-1] = 0xFFFFFF
+        writer = ClipWriter(width, height)
+        writer.add_frame(first)
+        writer.add_frame(second)
+        
+        reader = ClipReader(io.BytesIO(writer.to_bytes()))
+        display = FrameDisplay(width, height)
+        await reader.draw_next(display)
+        await reader.draw_next(display)
+        assert list(display.pixels) == second
+    
+    def test_palette_reduced_past_256_colors(self):
+        """Test that too many colors are folded into a 256 color palette."""
+        writer = ClipWriter(32, 16)
+        writer.add_frame([(i << 12) | i for i in range(512)])
+        reader = ClipReader(io.BytesIO(writer.to_bytes()))
+        assert 0 < len(reader.palette) <= 256
+    
+    def test_rejects_bad_input(self):
+        """Test errors for wrong frame sizes and foreign files."""
+        with pytest.raises(ValueError):
+            ClipWriter(8, 4).add_frame([0] * 31)
+        with pytest.raises(ValueError):
+            ClipWriter(8, 4, fps=0)
+        with pytest.raises(ValueError):
+            ClipReader(io.BytesIO(b'GIF89a' + bytes(20)))
+
+
+class TestClipPlayback:
+    """Test cases for timed playback."""
+    
+    @pytest.mark.asyncio
+    async def test_plays_every_frame_on_time(self):
+        """Test that a fast display shows each frame once per frame period."""
+        writer = ClipWriter(8, 4, fps=4)
+        frames = moving_dot_frames(4)
+        for frame in frames:
+            writer.add_frame(frame)
+        clock = FakeClock()
+        # Each show lands exactly on the next frame deadline
+        display = FrameDisplay(clock=clock, show_cost=0.25)
+        reader = ClipReader(io.BytesIO(writer.to_bytes()))
+        
+        shown = await reader.play(display, loops=2, timeline=Timeline(clock))
+        
+        assert shown == 8
+        assert list(display.pixels) == frames[-1]
+    
+    @pytest.mark.asyncio
+    async def test_slow_display_skips_frames(self):
+        """Test that a display slower than the clip shows fewer frames."""
+        writer = ClipWriter(8, 4, fps=4)
+        frames = moving_dot_frames(8)
+        for frame in frames:
+            writer.add_frame(frame)
+        clock = FakeClock()
+        # Every show takes two frame periods
+        display = FrameDisplay(clock=clock, show_cost=0.5)
+        reader = ClipReader(io.BytesIO(writer.to_bytes()))
+        
+        shown = await reader.play(display, timeline=Timeline(clock))
+        
+        # Frames 0, 2, 4 and 6, then the last frame when the clip runs out
+        assert shown == 5
+        assert clock.now == pytest.approx(2.5)
+        # Skipped frames were still decoded, so the last frame is exact
+        assert list(display.pixels) == frames[-1]
+
+
+class TestClipBaker:
+    """Test cases for recording animations into clips."""
+    
+    @pytest.mark.asyncio
+    async def test_records_and_resamples(self):
+        """Test that captures are resampled to the clip frame rate."""
+        clock = FakeClock()
+        display = FrameDisplay()
+        baker = ClipBaker(display, fps=4, timeline=Timeline(clock))
+        
+        async def animation():
+            # Three shows at uneven times: 0.0, 0.5 and 0.6 seconds
+            for color, delay in ((1, 0.5), (2, 0.1), (3, 0.0)):
+                await display.fill(color)
+                await display.show()
+                clock.now += delay
+        
+        writer = await baker.record(animation())
+        
+        # Frames at 0, 0.25, 0.5 show what was on screen at those moments
+        assert [frame[0] for frame in writer.frames] == [1, 1, 2]
+        # The recording hook is gone afterwards
+        assert 'show' not in display.__dict__
+
+
+class TestClipStrategy:
+    """Test cases for the clip display strategy."""
+    
+    def test_registered(self):
+        """Test that clips can be queued by strategy name."""
+        assert get_strategy_registry().get_strategy('clip') is ClipStrategy
+    
+    @pytest.mark.asyncio
+    async def test_plays_clip_file(self, tmp_path):
+        """Test playing a clip file and reporting its duration."""
+        writer = ClipWriter(8, 4, fps=20)
+        frames = moving_dot_frames(3)
+        for frame in frames:
+            writer.add_frame(frame)
+        path = str(tmp_path / 'dot.sldc')
+        writer.save(path)
+        
+        strategy = ClipStrategy()
+        assert strategy.validate_data({'path': path})
+        assert not strategy.validate_data({})
+        assert strategy.get_render_duration({'path': path, 'loops': 2}) == pytest.approx(0.3)
+        assert strategy.get_render_duration({'path': str(tmp_path / 'missing.sldc')}) is None
+        # The duration comes from the header alone
+        header = str(tmp_path / 'header.sldc')
+        with open(header, 'wb') as f:
+            f.write(writer.to_bytes()[:HEADER_SIZE])
+        assert strategy.get_render_duration({'path': header}) == pytest.approx(0.15)
+        
+        display = FrameDisplay()
+        await strategy.render(display, {'path': path})
+        assert list(display.pixels) == frames[-1]
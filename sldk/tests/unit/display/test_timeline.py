@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""Unit tests for the shared animation timeline."""
+
+import pytest
+from unittest.mock import MagicMock, AsyncMock, patch
+
+from sldk.display.timeline import (
+    Timeline, EASINGS, get_easing, linear, ease_in_out, bounce, play_steps
+)
+from sldk.display.content import ScrollingText
+from tests.unit.fakes import FakeClock
+
+
+class TestEasing:
+    """Test cases for the easing functions."""
+    
+    def test_every_easing_spans_zero_to_one(self):
+        """Test that each curve starts at 0 and ends at 1."""
+        for name, easing in EASINGS.items():
+            assert easing(0.0) == pytest.approx(0.0), name
+            assert easing(1.0) == pytest.approx(1.0), name
+    
+    def test_curve_shapes(self):
+        """Test points on the curves shared with cpyapp styles."""
+        assert ease_in_out(0.5) == pytest.approx(0.5)
+        assert ease_in_out(0.25) == pytest.approx(0.15625)
+        assert bounce(0.25) == pytest.approx(0.03125)
+        assert bounce(0.75) == pytest.approx(1.03125)
+        assert get_easing('ease_out')(0.5) == pytest.approx(0.75)
+    
+    def test_get_easing(self):
+        """Test resolving names and functions."""
+        custom = lambda t: t
+        assert get_easing(custom) is custom
+        assert get_easing('bounce') is bounce
+        assert get_easing('no_such_curve') is linear
+        assert get_easing(None) is linear
+
+
+class TestAnimation:
+    """Test cases for timed animations."""
+    
+    def test_progress_follows_clock(self):
+        """Test that progress comes from elapsed time and clamps."""
+        clock = FakeClock(10.0)
+        animation = Timeline(clock).animate(2.0)
+        
+        assert animation.progress == 0.0
+        clock.now = 10.5
+        assert animation.progress == pytest.approx(0.25)
+        assert animation.step(8) == 2
+        assert not animation.done
+        clock.now = 13.0
+        assert animation.progress == 1.0
+        assert animation.step(8) == 8
+        assert animation.done
+    
+    def test_eased_value(self):
+        """Test that value applies the easing."""
+        clock = FakeClock()
+        animation = Timeline(clock).animate(1.0, 'ease_in')
+        clock.now = 0.5
+        assert animation.value == pytest.approx(0.25)
+    
+    def test_zero_duration_is_done(self):
+        """Test that an instant animation is complete at once."""
+        assert Timeline(FakeClock()).animate(0.0).done
+
+
+class TestFrameScheduler:
+    """Test cases for deadline-based frames."""
+    
+    def test_deadlines_and_skipping(self):
+        """Test that frames fall on fixed deadlines and late ones are dropped."""
+        clock = FakeClock()
+        frames = Timeline(clock).frames(4)
+        
+        assert frames.ready()       # First frame is due at once
+        clock.now = 0.1
+        assert not frames.ready()
+        clock.now = 0.25
+        assert frames.ready()
+        
+        # Render stalls past four more deadlines
+        clock.now = 1.3
+        assert frames.ready()
+        assert frames.skipped == 3
+        assert frames.frame == 6
+        
+        # The schedule keeps its phase instead of restarting from 1.3
+        clock.now = 1.4
+        assert not frames.ready()
+        clock.now = 1.5
+        assert frames.ready()
+    
+    @pytest.mark.asyncio
+    async def test_wait_reports_frames_advanced(self):
+        """Test that a late wait counts the frames it skipped."""
+        clock = FakeClock()
+        frames = Timeline(clock).frames(4)
+        
+        assert await frames.wait() == 1
+        clock.now = 0.8
+        assert await frames.wait() == 3
+        assert frames.skipped == 2
+    
+    def test_reset(self):
+        """Test that reset makes the next frame due immediately."""
+        clock = FakeClock()
+        frames = Timeline(clock).frames(4)
+        frames.ready()
+        frames.reset()
+        assert frames.ready()
+
+
+class TestPlaySteps:
+    """Test cases for stepping an animation on the timeline."""
+    
+    @pytest.mark.asyncio
+    async def test_slow_draws_skip_steps_and_end_on_time(self):
+        """Test that a draw slower than a frame jumps ahead to the clock."""
+        clock = FakeClock()
+        drawn = []
+        
+        async def draw(step):
+            drawn.append(step)
+            clock.now += 0.25     # Each draw takes two frames
+        
+        count = await play_steps(8, 1.0, draw, timeline=Timeline(clock))
+        
+        assert drawn == [0, 2, 4, 6, 8]
+        assert count == 5
+        assert clock.now == pytest.approx(1.25)
+    
+    @pytest.mark.asyncio
+    async def test_overshooting_easing_lasts_full_duration(self):
+        """Test that bounce, which passes 1 at the midpoint, doesn't end early"""
+        clock = FakeClock()
+        drawn = []
+        
+        async def draw(step):
+            drawn.append(step)
+        
+        async def tick(seconds):
+            clock.now += 0.125
+        
+        with patch('sldk.display.timeline._sleep', tick):
+            await play_steps(8, 1.0, draw, easing='bounce', timeline=Timeline(clock))
+        
+        assert drawn == sorted(set(drawn))
+        assert drawn[-1] == 8
+        assert clock.now == pytest.approx(1.0)
+    
+    @pytest.mark.asyncio
+    async def test_easing_short_of_one_still_ends(self):
+        """Test that a curve that never reaches 1 ends on the final step"""
+        clock = FakeClock()
+        drawn = []
+        
+        async def draw(step):
+            drawn.append(step)
+        
+        async def tick(seconds):
+            clock.now += 0.25
+        
+        with patch('sldk.display.timeline._sleep', tick):
+            count = await play_steps(4, 1.0, draw, easing=lambda t: t / 2,
+                                     timeline=Timeline(clock))
+        
+        assert drawn == [0, 1, 2, 4]
+        assert count == 4
+    
+    @pytest.mark.asyncio
+    async def test_zero_duration_draws_every_step(self):
+        """Test that an untimed animation draws each step in turn."""
+        drawn = []
+        
+        async def draw(step):
+            drawn.append(step)
+        
+        await play_steps(4, 0.0, draw, start=1)
+        assert drawn == [1, 2, 3, 4]
+
+
+class TestScrollingTextTimeline:
+    """Test cases for scrolling driven by the timeline."""
+    
+    @pytest.mark.asyncio
+    async def test_position_follows_speed(self):
+        """Test that text moves speed pixels per second between renders."""
+        clock = FakeClock(5.0)
+        display = MagicMock()
+        display.width = 64
+        display.draw_text = AsyncMock()
+        text = ScrollingText("Hi", y=0, speed=20)
+        
+        with patch('sldk.display.content.get_timeline', return_value=Timeline(clock)):
+            await text.render(display)
+            clock.now = 5.5
+            await text.render(display)
+            clock.now = 5.75
+            await text.render(display)
+        
+        positions = [call.args[1] for call in display.draw_text.call_args_list]
+        assert positions == [64, 54, 49]
@@ -6,7 +6,12 @@ import asyncio
 from unittest.mock import MagicMock, AsyncMock, patch
 
 from sldk.effects import EffectsEngine
-from sldk.effects.effects import SparkleEffect, EdgeGlowEffect, RainbowCycleEffect
+from sldk.effects.base import Effect, CompositeEffect
+from sldk.effects.effects import (
+    SparkleEffect, EdgeGlowEffect, RainbowCycleEffect, CornerFlashEffect, PulseEffect
+)
+from sldk.effects.framebuffer import BLEND_ADD, BLEND_MULTIPLY, BLEND_MAX
+from tests.unit.fakes import FrameDisplay
 
 
 class TestEffectsEngine:
@@ -397,4 +402,133 @@ class TestEffectsMemoryUsage:
                 if effect.duration and (mock_get_time.return_value - effect.start_time) > effect.duration:
                     expired_count += 1
             
-            assert expired_count == 3  # All should be expired
\ No newline at end of file
+            assert expired_count == 3  # All should be expired
+
+
+class StepEffect(Effect):
+    """Effect that drives a fixed number of frames through apply()."""
+    
+    def __init__(self, steps=3):
+        super().__init__(duration=0.0)
+        self.steps = steps
+    
+    async def apply(self, display, render_func):
+        for _ in range(self.steps):
+            await render_func()
+
+
+class TestFrameComposition:
+    """Test cases for layering effects in a shared frame buffer."""
+    
+    @pytest.mark.asyncio
+    async def test_layers_drawn_in_one_batch(self):
+        """Test that rainbow, sparkle and edge glow composite into one write."""
+        engine = EffectsEngine(max_effects=3, target_fps=10)
+        display = FrameDisplay(16, 8)
+        
+        with patch('sldk.effects.effects.get_time', return_value=10.0):
+            engine.add_effect(RainbowCycleEffect())
+            engine.add_effect(SparkleEffect(intensity=5))
+            engine.add_effect(EdgeGlowEffect(color=0xFFFFFF))
+        with patch('sldk.effects.effects.get_time', return_value=10.5):
+            await engine.update(display)
+        
+        assert len(display.batches) == 1
+        assert display.single_pixels == 0
+        batch = display.batch_colors(0)
+        # The rainbow sweep is at pixel 5 after half a second
+        assert all((x, 0) in batch for x in range(5, 9))
+        # Pixels no layer touched keep the content underneath
+        assert (7, 3) not in batch
+        assert len(batch) < 16 * 8
+    
+    @pytest.mark.asyncio
+    async def test_blend_modes_apply_in_layer_order(self):
+        """Test that later layers blend over earlier ones."""
+        engine = EffectsEngine(max_effects=3, target_fps=10)
+        display = FrameDisplay(16, 8)
+        
+        with patch('sldk.effects.effects.get_time', return_value=0.0):
+            engine.add_effect(CornerFlashEffect(color=0x808080, flash_duration=1.0, interval=2.0))
+            engine.add_effect(CornerFlashEffect(color=0x40FF00, flash_duration=1.0, interval=2.0),
+                              blend_mode=BLEND_ADD)
+            engine.add_effect(CornerFlashEffect(color=0x0000FF, flash_duration=1.0, interval=2.0),
+                              blend_mode=BLEND_MULTIPLY)
+        with patch('sldk.effects.effects.get_time', return_value=0.5):
+            await engine.update(display)
+        
+        # (0x80, 0x80, 0x80) + (0x40, 0xFF, 0x00) = (0xC0, 0xFF, 0x80), then * blue
+        assert display.batch_colors(0)[(0, 0)] == 0x000080
+        assert display.batch_colors(0)[(15, 7)] == 0x000080
+    
+    def test_default_blend_modes(self):
+        """Test each effect's default layer blend mode."""
+        assert SparkleEffect().blend_mode == BLEND_ADD
+        assert EdgeGlowEffect().blend_mode == BLEND_MAX
+        assert EdgeGlowEffect(duration=1.0).opacity == 1.0
+    
+    def test_sparkle_render_is_pure(self):
+        """Test that a sparkle frame depends only on the elapsed time."""
+        from sldk.effects.framebuffer import FrameBuffer
+        effect = SparkleEffect(intensity=3)
+        
+        def frame_at(elapsed):
+            frame = FrameBuffer(16, 8)
+            frame.begin()
+            effect.render(frame, elapsed)
+            return [frame.touched[n] for n in range(frame.touched_count)], list(frame.pixels)
+        
+        assert frame_at(0.75) == frame_at(0.75)
+        # Slots start 0.3s apart
+        assert len(frame_at(0.1)[0]) == 1
+        assert len(frame_at(0.75)[0]) == 3
+    
+    @pytest.mark.asyncio
+    async def test_non_frame_effects_still_update(self):
+        """Test that a brightness pulse runs alongside frame effects."""
+        engine = EffectsEngine(max_effects=2, target_fps=10)
+        display = FrameDisplay(16, 8)
+        
+        with patch('sldk.effects.effects.get_time', return_value=0.0):
+            engine.add_effect(EdgeGlowEffect())
+            engine.add_effect(PulseEffect(speed=1.0, min_brightness=0.2, max_brightness=0.6))
+        with patch('sldk.effects.effects.get_time', return_value=0.25):
+            await engine.update(display)
+        
+        assert len(display.batches) == 1
+        assert display.brightness == pytest.approx(0.6)
+    
+    @pytest.mark.asyncio
+    async def test_parallel_composite_runs_every_layer(self):
+        """Test that a parallel composite layers all frame effects each frame."""
+        display = FrameDisplay(16, 8)
+        composite = CompositeEffect([
+            StepEffect(steps=3),
+            CornerFlashEffect(color=0x100000, flash_duration=10.0, interval=20.0),
+            CornerFlashEffect(color=0x001000, flash_duration=10.0, interval=20.0,
+                              duration=None),
+        ], mode='parallel')
+        composite.effects[2].blend_mode = BLEND_ADD
+        render_func = AsyncMock()
+        
+        await composite.apply(display, render_func)
+        
+        assert render_func.await_count == 3
+        assert len(display.batches) == 3
+        assert all(display.batch_colors(n)[(0, 0)] == 0x101000 for n in range(3))
+    
+    @pytest.mark.asyncio
+    async def test_parallel_composite_without_driver(self):
+        """Test that layers alone run their own frame loop."""
+        display = FrameDisplay(16, 8)
+        composite = CompositeEffect([EdgeGlowEffect(duration=0.0)], mode='parallel', fps=50)
+        
+        await composite.apply(display, AsyncMock())
+        
+        assert display.shows == 1
+        assert len(display.batches) == 1
+    
+    def test_parallel_composite_allows_one_driver(self):
+        """Test that two apply() effects can't run in the same frames."""
+        with pytest.raises(ValueError):
+            CompositeEffect([StepEffect(), StepEffect()], mode='parallel')
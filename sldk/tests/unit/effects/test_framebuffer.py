@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Unit tests for the shared effects frame buffer."""
+
+import pytest
+from unittest.mock import MagicMock, AsyncMock
+
+from sldk.effects.framebuffer import (
+    FrameBuffer, blend_color, BLEND_ADD, BLEND_MULTIPLY, BLEND_ALPHA, BLEND_MAX
+)
+from tests.unit.fakes import FrameDisplay
+
+
+class TestBlendColor:
+    """Test cases for the blend modes."""
+    
+    def test_add_clamps_each_channel(self):
+        """Test that add sums channels and saturates at 255."""
+        assert blend_color(0x102030, 0x010203, BLEND_ADD) == 0x112233
+        assert blend_color(0xF08010, 0x20A010, BLEND_ADD) == 0xFFFF20
+    
+    def test_multiply(self):
+        """Test that multiply scales by the layer color."""
+        assert blend_color(0xFF8040, 0xFFFFFF, BLEND_MULTIPLY) == 0xFF8040
+        assert blend_color(0xFF8040, 0x000000, BLEND_MULTIPLY) == 0x000000
+        assert blend_color(0xFFFFFF, 0x80FF00, BLEND_MULTIPLY) == 0x80FF00
+    
+    def test_alpha(self):
+        """Test that alpha mixes toward the layer color by opacity."""
+        assert blend_color(0x000000, 0x123456, BLEND_ALPHA) == 0x123456
+        assert blend_color(0x000000, 0xC86400, BLEND_ALPHA, 0.5) == 0x643200
+    
+    def test_max(self):
+        """Test that max keeps the brighter channel."""
+        assert blend_color(0x804020, 0x20FF10, BLEND_MAX) == 0x80FF20
+    
+    def test_zero_opacity_leaves_pixel(self):
+        """Test that a transparent layer changes nothing."""
+        for mode in (BLEND_ADD, BLEND_MULTIPLY, BLEND_ALPHA, BLEND_MAX):
+            assert blend_color(0x336699, 0xFFFFFF, mode, 0.0) == 0x336699
+    
+    def test_unknown_mode(self):
+        """Test that an unknown blend mode is rejected."""
+        with pytest.raises(ValueError):
+            blend_color(0, 0, 'screen')
+
+
+class TestFrameBuffer:
+    """Test cases for FrameBuffer."""
+    
+    def test_layers_blend_at_shared_pixels(self):
+        """Test that a second layer blends with the first."""
+        frame = FrameBuffer(8, 4)
+        frame.begin()
+        frame.blend(1, 1, 0x400000, BLEND_ALPHA)
+        frame.blend(1, 1, 0x004000, BLEND_ADD)
+        frame.blend(2, 1, 0x004000, BLEND_ADD)
+        
+        assert frame.get_pixel(1, 1) == 0x404000
+        assert frame.get_pixel(2, 1) == 0x004000
+        assert frame.get_pixel(3, 1) == 0x000000
+        assert frame.touched_count == 2
+    
+    def test_first_layer_blends_against_base_color(self):
+        """Test that untouched pixels read as the base color."""
+        frame = FrameBuffer(8, 4, base_color=0x202020)
+        frame.begin()
+        frame.blend(0, 0, 0x010101, BLEND_ADD)
+        assert frame.get_pixel(0, 0) == 0x212121
+        assert frame.get_pixel(7, 3) == 0x202020
+    
+    def test_off_frame_pixels_ignored(self):
+        """Test that writes outside the frame are dropped."""
+        frame = FrameBuffer(8, 4)
+        frame.begin()
+        for x, y in ((-1, 0), (8, 0), (0, -1), (0, 4)):
+            frame.blend(x, y, 0xFFFFFF)
+        assert frame.touched_count == 0
+    
+    @pytest.mark.asyncio
+    async def test_flush_sends_touched_pixels_in_one_batch(self):
+        """Test that only touched pixels reach the display, in one call."""
+        frame = FrameBuffer(8, 4)
+        display = FrameDisplay()
+        frame.begin()
+        frame.blend(5, 2, 0x00FF00)
+        frame.blend(0, 3, 0x0000FF)
+        
+        assert await frame.flush(display) == 2
+        assert display.batches == [[(5, 2, 0x00FF00), (0, 3, 0x0000FF)]]
+    
+    @pytest.mark.asyncio
+    async def test_begin_starts_a_fresh_frame(self):
+        """Test that pixels from the previous frame are not redrawn."""
+        frame = FrameBuffer(8, 4)
+        display = FrameDisplay()
+        frame.begin()
+        frame.blend(5, 2, 0x00FF00)
+        await frame.flush(display)
+        
+        frame.begin()
+        frame.blend(5, 2, 0x000010, BLEND_ADD)
+        await frame.flush(display)
+        assert display.batches[1] == [(5, 2, 0x000010)]
+    
+    @pytest.mark.asyncio
+    async def test_flush_to_duck_typed_display(self):
+        """Test the per-pixel fallback for displays without set_pixels."""
+        frame = FrameBuffer(8, 4)
+        display = MagicMock()
+        display.set_pixel = AsyncMock()
+        frame.begin()
+        frame.blend(1, 2, 0xABCDEF)
+        
+        await frame.flush(display)
+        display.set_pixel.assert_called_once_with(1, 2, 0xABCDEF)
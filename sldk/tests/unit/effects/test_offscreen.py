@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""Unit tests for offscreen transitions."""
+
+import pytest
+from array import array
+from unittest.mock import MagicMock, AsyncMock
+
+from sldk.display.queue import DisplayQueue
+from sldk.display.strategy import DisplayItem, DisplayStrategy, register_strategy
+from sldk.effects.reveal import RevealEffect
+from sldk.effects.basic_transitions import WipeEffect, SlideInEffect
+from sldk.effects.offscreen import CrossFadeEffect
+from tests.unit.fakes import FrameDisplay
+
+
+def content(display, color=0x00FF00):
+    """Make a render function that fills the display and counts its calls."""
+    async def render():
+        render.calls += 1
+        for y in range(display.height):
+            for x in range(display.width):
+                await display.set_pixel(x, y, color)
+    render.calls = 0
+    return render
+
+
+class TestOffscreenTransitions:
+    """Test cases for transitions composited from captured frames."""
+    
+    @pytest.mark.asyncio
+    async def test_reveal_renders_content_once(self):
+        """Test that reveal steps composite the capture instead of re-rendering."""
+        display = FrameDisplay()
+        render = content(display)
+        effect = RevealEffect(duration=0.0, direction='right', pause_at_end=0.0)
+        
+        await effect.apply(display, render)
+        
+        # Once to capture, once to hand the live content back
+        assert render.calls == 2
+        # Eight steps each uncover one column of four pixels
+        assert display.batch_sizes() == [4] * 8
+        assert list(display.pixels) == [0x00FF00] * 32
+    
+    def test_wipe_keeps_outgoing_content(self):
+        """Test that a wipe shows the old frame beyond its edge."""
+        effect = WipeEffect(direction='down')
+        source = array('L', [0xFF0000] * 32)
+        dest = array('L', [0x0000FF] * 32)
+        target = array('L', [0] * 32)
+        
+        effect.compose(source, dest, target, 8, 4, 0.5)
+        
+        assert list(target[:16]) == [0x0000FF] * 16
+        assert list(target[16:]) == [0xFF0000] * 16
+    
+    @pytest.mark.asyncio
+    async def test_wipe_draws_captured_source_first(self):
+        """Test that the outgoing frame survives the clear before the wipe."""
+        display = FrameDisplay()
+        await display.fill(0xFF0000)
+        render = content(display, 0x0000FF)
+        
+        await WipeEffect(duration=0.0, direction='right').apply(display, render)
+        
+        # Whole source frame, then one column per step
+        assert display.batch_sizes() == [32] + [4] * 8
+        assert render.calls == 2
+    
+    def test_slide_offsets_the_capture(self):
+        """Test that a slide shifts the destination frame."""
+        effect = SlideInEffect(direction='left')
+        dest = array('L', range(1, 33))
+        target = array('L', [0] * 32)
+        
+        effect.compose(array('L', [0] * 32), dest, target, 8, 4, 0.5)
+        
+        # Halfway through, the left half of the content sits in the right half
+        assert list(target[0:8]) == [0, 0, 0, 0, 1, 2, 3, 4]
+        assert list(target[24:32]) == [0, 0, 0, 0, 25, 26, 27, 28]
+        
+        effect.compose(array('L', [0] * 32), dest, target, 8, 4, 1.0)
+        assert list(target) == list(dest)
+    
+    def test_cross_fade_mixes_frames(self):
+        """Test the blend between the outgoing and incoming frames."""
+        effect = CrossFadeEffect()
+        source = array('L', [0xFF0000] * 4)
+        dest = array('L', [0x0000FF, 0x0000FF, 0xFF0000, 0x00FF00])
+        target = array('L', [0] * 4)
+        
+        effect.compose(source, dest, target, 2, 2, 0.5)
+        assert list(target) == [0x7F007F, 0x7F007F, 0xFF0000, 0x7F7F00]
+        
+        effect.compose(source, dest, target, 2, 2, 1.0)
+        assert list(target) == list(dest)
+    
+    @pytest.mark.asyncio
+    async def test_live_fallback_without_capture(self):
+        """Test that displays without capture re-render each step as before."""
+        display = FrameDisplay(can_capture=False)
+        render = content(display)
+        effect = RevealEffect(duration=0.0, direction='down', pause_at_end=0.0)
+        
+        await effect.apply(display, render)
+        
+        # One render that found capture unsupported, then one per step
+        assert render.calls == 1 + 5
+        assert display.batches == []
+
+
+@register_strategy('offscreen_test_fill')
+class FillStrategy(DisplayStrategy):
+    """Strategy that fills the display with data['color']."""
+    
+    async def render(self, display, data):
+        await display.fill(data['color'])
+
+
+class TestQueueTransition:
+    """Test cases for transitions between consecutive display items."""
+    
+    @pytest.mark.asyncio
+    async def test_transition_between_items(self):
+        """Test that the queue transition plays when an item replaces another."""
+        queue = DisplayQueue()
+        transition = MagicMock()
+        transition.apply = AsyncMock()
+        queue.set_transition(transition)
+        display = FrameDisplay()
+        
+        queue.add_item(DisplayItem('offscreen_test_fill', {'color': 1}, duration=0))
+        await queue.process_next(display)
+        # Nothing was showing before the first item
+        transition.apply.assert_not_called()
+        
+        queue.add_item(DisplayItem('offscreen_test_fill', {'color': 2}, duration=0))
+        await queue.process_next(display)
+        transition.apply.assert_awaited_once()
+    
+    @pytest.mark.asyncio
+    async def test_item_effects_replace_transition(self):
+        """Test that an item's own effects play instead of the queue transition."""
+        queue = DisplayQueue()
+        transition = MagicMock()
+        transition.apply = AsyncMock()
+        queue.set_transition(transition)
+        display = FrameDisplay()
+        
+        queue.add_item(DisplayItem('offscreen_test_fill', {'color': 1}, duration=0))
+        await queue.process_next(display)
+        own = MagicMock()
+        own.apply = AsyncMock()
+        queue.add_item(DisplayItem('offscreen_test_fill', {'color': 2}, duration=0).with_effect(own))
+        await queue.process_next(display)
+        
+        own.apply.assert_awaited_once()
+        transition.apply.assert_not_called()
+    
+    @pytest.mark.asyncio
+    async def test_cross_fade_between_items(self):
+        """Test a real cross-fade ending on the incoming item's frame."""
+        queue = DisplayQueue()
+        queue.set_transition(CrossFadeEffect(duration=0.0, steps=4))
+        display = FrameDisplay()
+        
+        queue.add_item(DisplayItem('offscreen_test_fill', {'color': 0xFF0000}, duration=0))
+        await queue.process_next(display)
+        queue.add_item(DisplayItem('offscreen_test_fill', {'color': 0x0000FF}, duration=0))
+        await queue.process_next(display)
+        
+        # Outgoing frame, then every pixel changes on each of the four steps
+        assert display.batch_sizes() == [32, 32, 32, 32, 32]
+        assert list(display.pixels) == [0x0000FF] * 32
+
+
+class TestSimulatorTransition:
+    """Test cases for offscreen transitions on the LED simulator."""
+    
+    @pytest.mark.asyncio
+    async def test_steps_survive_scene_refresh(self, monkeypatch):
+        """Test that composited steps reach the matrix instead of the scene."""
+        pytest.importorskip("numpy")
+        monkeypatch.setenv('SLDK_HEADLESS', '1')
+        from sldk.display.simulator import SimulatorDisplay
+        from sldk.display.clip import ClipBaker
+        
+        display = SimulatorDisplay(width=16, height=8)
+        await display.initialize()
+        
+        async def render():
+            await display.draw_text("Hi", x=0, y=4, color=0xFFFFFF)
+        
+        # Record what every show() put on the matrix
+        baker = ClipBaker(display)
+        await baker.record(CrossFadeEffect(duration=0.1, steps=4).apply(display, render))
+        frames = [pixels for _, pixels in baker.captures]
+        
+        text = max(frames[-1])
+        assert text > 0
+        # Fading steps show dimmed text; a restored scene would be blank
+        assert any(0 < color < text for frame in frames for color in frame)
+        # Afterwards the display shows its live content again
+        assert not display.display.direct_drawing
@@ -5,7 +5,8 @@ import pytest
 import asyncio
 from unittest.mock import MagicMock, AsyncMock, patch
 
-from sldk.effects.particles import ParticleEngine, Sparkle, RainDrop, Snow, Ember
+from sldk.effects.particles import ParticleEngine, Sparkle, RainDrop, Snow, Ember, KIND_SPARKLE, KIND_SNOW
+from tests.unit.fakes import FrameDisplay
 
 
 class TestParticleEngine:
@@ -462,4 +463,92 @@ class TestParticleIntegration:
             engine.add_particle(particle)
         
         # Should not exceed max_particles
-        assert engine.get_particle_count() <= 2
\ No newline at end of file
+        assert engine.get_particle_count() <= 2
+
+class TestPooledParticles:
+    """Test cases for the slot arrays and batched drawing."""
+    
+    @pytest.mark.asyncio
+    async def test_one_batched_write_per_frame(self):
+        """Test that preset particles are drawn with a single set_pixels call."""
+        engine = ParticleEngine(max_particles=4)
+        display = FrameDisplay(64, 32)
+        
+        with patch('sldk.effects.particles.get_time', return_value=100.0):
+            engine.add_particle(RainDrop(x=3, y=0, speed=10.0, color=0x0000FF))
+            engine.add_particle(Sparkle(x=5, y=6, color=0xFF0000, lifetime=1.0))
+        with patch('sldk.effects.particles.get_time', return_value=100.25):
+            await engine.update(display)
+        
+        assert display.single_pixels == 0
+        assert len(display.batches) == 1
+        # The sparkle has started to fade from its peak at 0.2s
+        assert sorted(display.batches[0]) == [(3, 2, 0x0000FF), (5, 6, 0xEF0000)]
+    
+    @pytest.mark.asyncio
+    async def test_slots_are_reused(self):
+        """Test that expired slots go back on the free list."""
+        engine = ParticleEngine(max_particles=2)
+        display = FrameDisplay(64, 32)
+        
+        with patch('sldk.effects.particles.get_time', return_value=10.0):
+            assert engine.spawn(KIND_SPARKLE, 1, 1, 0.5)
+            assert engine.spawn(KIND_SPARKLE, 2, 2, 5.0)
+            assert not engine.spawn(KIND_SPARKLE, 3, 3, 5.0)
+        with patch('sldk.effects.particles.get_time', return_value=11.0):
+            await engine.update(display)
+            assert engine.get_particle_count() == 1
+            assert engine.spawn(KIND_SPARKLE, 4, 4, 5.0)
+        assert engine.get_particle_count() == 2
+        assert engine.particles == []
+    
+    @pytest.mark.asyncio
+    async def test_off_screen_deaths(self):
+        """Test rain falling past the bottom and embers rising past the top."""
+        engine = ParticleEngine(max_particles=3)
+        display = FrameDisplay(64, 32)
+        
+        with patch('sldk.effects.particles.get_time', return_value=0.0):
+            engine.add_particle(RainDrop(x=1, y=30, speed=10.0, lifetime=10.0))
+            engine.add_particle(Ember(x=1, y=1, speed=10.0, lifetime=10.0))
+            engine.add_particle(Snow(x=10, y=0, speed=1.0, lifetime=10.0))
+        with patch('sldk.effects.particles.get_time', return_value=0.5):
+            await engine.update(display)
+        
+        assert engine.get_particle_count() == 1
+        assert [type(p) for p in engine.particles] == [Snow]
+    
+    @pytest.mark.asyncio
+    async def test_custom_particles_render_themselves(self):
+        """Test that particles that aren't presets keep their own update and render."""
+        engine = ParticleEngine(max_particles=3)
+        display = FrameDisplay(64, 32)
+        custom = MagicMock()
+        custom.is_dead.return_value = False
+        custom.render = AsyncMock()
+        
+        engine.add_particle(custom)
+        engine.add_particle(Sparkle(x=1, y=1))
+        await engine.update(display)
+        
+        custom.update.assert_called_once()
+        custom.render.assert_called_once_with(display)
+        assert len(display.batches) == 1
+    
+    @pytest.mark.asyncio
+    async def test_hundreds_of_particles(self):
+        """Test a large pool without per-frame buffer allocation."""
+        engine = ParticleEngine(max_particles=400)
+        display = FrameDisplay(64, 32)
+        buffers = (engine.pixel_x, engine.pixel_y, engine.pixel_color)
+        
+        with patch('sldk.effects.particles.get_time', return_value=5.0):
+            for i in range(400):
+                engine.spawn(KIND_SNOW, i % 64, i % 30, 10.0, vy=2.0, sway=1.0, phase=i)
+        with patch('sldk.effects.particles.get_time', return_value=5.5):
+            await engine.update(display)
+        
+        assert engine.get_particle_count() == 400
+        assert len(display.batches) == 1
+        assert len(display.batches[0]) > 300
+        assert (engine.pixel_x, engine.pixel_y, engine.pixel_color) == buffers
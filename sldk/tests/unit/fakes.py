@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Fakes shared by the SLDK unit tests."""
+
+from array import array
+
+from sldk.display.interface import DisplayInterface
+
+
+class FakeClock:
+    """Clock that only moves when told to."""
+    
+    def __init__(self, now=0.0):
+        self.now = now
+    
+    def __call__(self):
+        return self.now
+
+
+class FrameDisplay(DisplayInterface):
+    """In-memory display that records pixel writes and can read its frame back."""
+    
+    def __init__(self, width=8, height=4, clock=None, show_cost=0.0, can_capture=True):
+        """Initialize the display.
+        
+        Args:
+            width: Display width in pixels
+            height: Display height in pixels
+            clock: Optional FakeClock that each show() advances
+            show_cost: Seconds each show() adds to the clock
+            can_capture: False to act like a display without read-back
+        """
+        self._width = width
+        self._height = height
+        self.pixels = array('L', [0] * (width * height))
+        self.clock = clock
+        self.show_cost = show_cost
+        self.can_capture = can_capture
+        self.brightness = 1.0
+        # One list of (x, y, color) per set_pixels() call
+        self.batches = []
+        self.single_pixels = 0
+        self.shows = 0
+    
+    @property
+    def width(self):
+        return self._width
+    
+    @property
+    def height(self):
+        return self._height
+    
+    @property
+    def writes(self):
+        """Number of pixels written through set_pixels()."""
+        return sum(len(batch) for batch in self.batches)
+    
+    def batch_sizes(self):
+        """Number of pixels in each set_pixels() call."""
+        return [len(batch) for batch in self.batches]
+    
+    def batch_colors(self, index):
+        """Map (x, y) to the color written by one set_pixels() call."""
+        return {(x, y): color for x, y, color in self.batches[index]}
+    
+    async def clear(self):
+        for i in range(len(self.pixels)):
+            self.pixels[i] = 0
+    
+    async def show(self):
+        self.shows += 1
+        if self.clock:
+            self.clock.now += self.show_cost
+    
+    async def set_pixel(self, x, y, color):
+        self.single_pixels += 1
+        self.pixels[y * self._width + x] = color
+    
+    async def set_pixels(self, xs, ys, colors, count):
+        self.batches.append([(xs[i], ys[i], colors[i]) for i in range(count)])
+        for i in range(count):
+            self.pixels[ys[i] * self._width + xs[i]] = colors[i]
+    
+    async def capture(self, pixels):
+        if not self.can_capture:
+            return False
+        pixels[:] = self.pixels
+        return True
@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+"""Unit tests for the displayio compositor."""
+
+import pytest
+import sys
+import os
+
+np = pytest.importorskip("numpy")
+pytest.importorskip("pygame")
+
+# Add path to enable sldk imports
+sldk_src_path = os.path.join(os.path.dirname(__file__), '../../../src')
+if sldk_src_path not in sys.path:
+    sys.path.insert(0, sldk_src_path)
+
+from sldk.simulator.displayio import Bitmap, Display, Group, Palette, TileGrid
+
+
+def _make_tiles():
+    """Two 2x2 tiles side by side: tile 0 is index 1, tile 1 is a diagonal."""
+    bitmap = Bitmap(4, 2, 3)
+    for y in range(2):
+        for x in range(2):
+            bitmap[x, y] = 1
+    bitmap[2, 0] = 2
+    bitmap[3, 1] = 2
+    palette = Palette(3)
+    palette[0] = 0x000000
+    palette[1] = 0xFF0000
+    palette[2] = 0x001F  # RGB565 blue
+    palette.make_transparent(0)
+    return bitmap, palette
+
+
+class TestTileGridIndexImage:
+    """Test cases for TileGrid.index_image."""
+
+    def test_grid_gathers_tiles(self):
+        """Test that each grid cell shows its tile."""
+        bitmap, palette = _make_tiles()
+        grid = TileGrid(bitmap, pixel_shader=palette, width=2, height=1,
+                        tile_width=2, tile_height=2)
+        grid[0, 0] = 1
+        grid[1, 0] = 0
+        expected = np.array([[2, 0, 1, 1],
+                             [0, 2, 1, 1]])
+        assert np.array_equal(grid.index_image(), expected)
+
+    def test_flip_and_transpose(self):
+        """Test that flips and transpose apply to the whole grid."""
+        bitmap, palette = _make_tiles()
+        grid = TileGrid(bitmap, pixel_shader=palette, width=2, height=1,
+                        tile_width=2, tile_height=2)
+        grid[0, 0] = 1
+        grid.flip_x = True
+        assert np.array_equal(grid.index_image(),
+                              np.array([[1, 1, 0, 2],
+                                        [1, 1, 2, 0]]))
+        grid.transpose_xy = True
+        assert grid.index_image().shape == (4, 2)
+
+
+class TestDisplayCompositor:
+    """Test cases for Display TileGrid composition."""
+
+    def _display(self):
+        return Display(None, width=8, height=4, auto_refresh=False)
+
+    def test_transparent_pixels_keep_background(self):
+        """Test that transparent palette entries do not overwrite."""
+        bitmap, palette = _make_tiles()
+        background_bitmap = Bitmap(8, 4, 1)
+        background_palette = Palette(1)
+        background_palette[0] = 0x07E0  # RGB565 green
+
+        root = Group()
+        root.append(TileGrid(background_bitmap, pixel_shader=background_palette))
+        root.append(TileGrid(bitmap, pixel_shader=palette, tile_width=2,
+                             tile_height=2, default_tile=1, x=1, y=1))
+        display = self._display()
+        display.show(root)
+        display.refresh()
+
+        frame = display.get_matrix().pixel_buffer.get_buffer()
+        assert tuple(frame[1, 1]) == (0, 0, 255)   # diagonal pixel
+        assert tuple(frame[1, 2]) == (0, 255, 0)   # transparent -> background
+
+    def test_scale_and_clip(self):
+        """Test that group scale repeats pixels and clips at the edge."""
+        bitmap, palette = _make_tiles()
+        root = Group(scale=2, x=6)
+        root.append(TileGrid(bitmap, pixel_shader=palette, tile_width=2,
+                             tile_height=2))
+        display = self._display()
+        display.show(root)
+        display.refresh()
+
+        frame = display.get_matrix().pixel_buffer.get_buffer()
+        assert tuple(frame[3, 6]) == (255, 0, 0)
+        assert tuple(frame[3, 7]) == (255, 0, 0)
+        assert tuple(frame[0, 5]) == (0, 0, 0)
+
+    def test_palette_change_is_picked_up(self):
+        """Test that palette writes invalidate the lookup table."""
+        bitmap, palette = _make_tiles()
+        root = Group()
+        root.append(TileGrid(bitmap, pixel_shader=palette, tile_width=2,
+                             tile_height=2))
+        display = self._display()
+        display.show(root)
+        display.refresh()
+        palette[1] = 0xFFFFFF
+        display.refresh()
+
+        frame = display.get_matrix().pixel_buffer.get_buffer()
+        assert tuple(frame[0, 0]) == (255, 255, 255)
+
+
+class TestRetainedMode:
+    """Test cases for cached subtree composition."""
+
+    def _scene(self):
+        bitmap, palette = _make_tiles()
+        logo = TileGrid(bitmap, pixel_shader=palette, tile_width=2, tile_height=2)
+        splash = Group()
+        splash.append(logo)
+
+        digit_bitmap = Bitmap(2, 2, 3)
+        digit = TileGrid(digit_bitmap, pixel_shader=palette, x=4)
+        root = Group()
+        root.append(splash)
+        root.append(digit)
+
+        display = Display(None, width=8, height=4, auto_refresh=False)
+        display.show(root)
+        display.refresh()
+        return display, root, splash, logo, digit_bitmap
+
+    def test_unchanged_scene_skips_composition(self, monkeypatch):
+        """Test that refreshing an unchanged scene does not recompose."""
+        display, _, _, _, _ = self._scene()
+        calls = []
+        monkeypatch.setattr(display, '_lookup_tables',
+                            lambda shader: calls.append(shader))
+        monkeypatch.setattr(display.get_matrix(), 'load_frame',
+                            lambda frame: calls.append(frame))
+        display.refresh()
+        assert calls == []
+
+    def test_static_subtree_is_reused(self):
+        """Test that a bitmap write does not recompose a sibling subtree."""
+        display, _, splash, logo, digit_bitmap = self._scene()
+        splash_layer = splash._layer_cache[2]
+        logo_layer = logo._layer_cache[2]
+
+        digit_bitmap[0, 0] = 1
+        display.refresh()
+
+        assert splash._layer_cache[2] is splash_layer
+        assert logo._layer_cache[2] is logo_layer
+        frame = display.get_matrix().pixel_buffer.get_buffer()
+        assert tuple(frame[0, 4]) == (255, 0, 0)
+
+    def test_moving_group_reuses_its_layer(self):
+        """Test that moving a group only re-places its cached layer."""
+        display, _, splash, _, _ = self._scene()
+        splash_layer = splash._layer_cache[2]
+
+        splash.x = 1
+        display.refresh()
+
+        assert splash._layer_cache[2] is splash_layer
+        frame = display.get_matrix().pixel_buffer.get_buffer()
+        assert tuple(frame[0, 0]) == (0, 0, 0)
+        assert tuple(frame[0, 1]) == (255, 0, 0)
+
+    def test_hiding_child_recomposes_parent(self):
+        """Test that visibility changes invalidate the parent."""
+        display, _, splash, logo, _ = self._scene()
+        logo.hidden = True
+        display.refresh()
+
+        frame = display.get_matrix().pixel_buffer.get_buffer()
+        assert tuple(frame[0, 0]) == (0, 0, 0)
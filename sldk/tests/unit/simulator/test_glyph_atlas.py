@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Unit tests for the glyph cache and packed glyph atlas."""
+
+import pytest
+import sys
+import os
+
+np = pytest.importorskip("numpy")
+pytest.importorskip("pygame")
+
+# Add path to enable sldk imports
+sldk_src_path = os.path.join(os.path.dirname(__file__), '../../../src')
+if sldk_src_path not in sys.path:
+    sys.path.insert(0, sldk_src_path)
+
+from sldk.simulator.adafruit_bitmap_font.bitmap_font import load_font
+from sldk.simulator.adafruit_bitmap_font.glyph_cache import GlyphCache
+from sldk.simulator.adafruit_bitmap_font.glyph_atlas import blit_mask
+
+
+class TestGlyphCache:
+    """Test cases for the LRU glyph cache."""
+
+    def test_evicts_least_recently_used(self):
+        """Test that a hit protects a glyph from eviction."""
+        cache = GlyphCache(max_glyphs=2)
+        cache.put(1, None, {'dx': 1})
+        cache.put(2, None, {'dx': 2})
+        assert cache.get(1) == {'dx': 1}
+
+        cache.put(3, None, {'dx': 3})
+        assert len(cache) == 2
+        assert cache.get(2) is None
+        assert cache.get(1) == {'dx': 1}
+        assert cache.get(3) == {'dx': 3}
+
+    def test_reinsert_does_not_evict(self):
+        """Test that replacing a cached glyph keeps the others."""
+        cache = GlyphCache(max_glyphs=2)
+        cache.put(1, None, {'dx': 1})
+        cache.put(2, None, {'dx': 2})
+        cache.put(1, None, {'dx': 10})
+        assert len(cache) == 2
+        assert cache.get(1) == {'dx': 10}
+        assert cache.get(2) == {'dx': 2}
+
+
+class TestGlyphAtlas:
+    """Test cases for GlyphAtlas."""
+
+    def test_decodes_glyph(self):
+        """Test that tom-thumb 'A' decodes to the BDF rows."""
+        font = load_font("tom-thumb.bdf")
+        atlas = font.atlas
+        pixels = atlas.glyph_pixels(atlas.index('A'))
+        expected = np.array([[0, 1, 0],
+                             [1, 0, 1],
+                             [1, 1, 1],
+                             [1, 0, 1],
+                             [1, 0, 1]], dtype=np.uint8)
+        assert np.array_equal(pixels, expected)
+        assert atlas.dx[atlas.index('A')] == 4
+
+    def test_glyph_bitmap_shares_atlas(self):
+        """Test that get_glyph hands out views into the atlas."""
+        font = load_font("tom-thumb.bdf")
+        glyph = font.get_glyph('A')
+        assert np.shares_memory(glyph['bitmap']._buffer, font.atlas.pixels)
+        assert glyph['bitmap'][1, 0] == 1
+        assert glyph['bitmap'][0, 0] == 0
+
+    def test_missing_char_uses_default(self):
+        """Test that unknown characters fall back to '?' once."""
+        font = load_font("tom-thumb.bdf")
+        missing = font.get_glyph(0x2603)
+        assert missing['width'] == font.get_glyph('?')['width']
+        assert font.get_glyph(0x2603) is missing
+
+    def test_blit_mask_clips(self):
+        """Test that glyph copies clip at every edge."""
+        target = np.zeros((4, 4), dtype=np.uint8)
+        mask = np.ones((3, 3), dtype=np.uint8)
+        blit_mask(target, mask, -1, 2)
+        assert target.sum() == 4
+        assert target[2:, :2].all()
+        blit_mask(target, mask, 10, 10)
+        assert target.sum() == 4
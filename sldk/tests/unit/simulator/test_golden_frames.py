@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""Unit tests for the golden-frame regression harness."""
+
+import pytest
+import sys
+import os
+
+np = pytest.importorskip("numpy")
+pytest.importorskip("pygame")
+
+# Add path to enable sldk imports
+sldk_src_path = os.path.join(os.path.dirname(__file__), '../../../src')
+if sldk_src_path not in sys.path:
+    sys.path.insert(0, sldk_src_path)
+
+from sldk.simulator.core import LEDMatrix, VirtualClock
+from sldk.simulator.testing import (FrameSet, FrameRecorder, assert_golden,
+                                    compare_frames)
+
+GOLDEN_DIR = os.path.join(os.path.dirname(__file__), 'golden')
+
+
+def make_frame(color=(0, 0, 0), width=64, height=32):
+    """Create a solid frame."""
+    frame = np.zeros((height, width, 3), dtype=np.uint8)
+    frame[:] = color
+    return frame
+
+
+class TestFrameSet:
+    """Test cases for frame encoding."""
+
+    def test_roundtrip(self):
+        """Test that encode/decode reproduces every pixel."""
+        rng = np.random.default_rng(7)
+        frame_set = FrameSet()
+        for t in range(3):
+            frame_set.add(t * 0.5, rng.integers(0, 256, (32, 64, 3), dtype=np.uint8))
+
+        decoded = FrameSet.decode(frame_set.encode())
+        assert decoded.timestamps == [0.0, 0.5, 1.0]
+        for want, got in zip(frame_set.frames, decoded.frames):
+            assert np.array_equal(want, got)
+
+    def test_flat_content_is_compact(self):
+        """Test that LED-style content encodes to a handful of runs."""
+        frame_set = FrameSet()
+        for shift in range(100):
+            frame = make_frame()
+            frame[10:20, shift % 64] = (255, 255, 0)
+            frame_set.add(shift / 60, frame)
+
+        encoded = frame_set.encode()
+        assert encoded["palette"].size == 2
+        # Far smaller than 100 raw frames of 6 KB each
+        assert encoded["values"].nbytes + encoded["lengths"].nbytes < 20000
+
+    def test_save_and_load(self, tmp_path):
+        """Test the on-disk format."""
+        frame_set = FrameSet()
+        frame_set.add(1.25, make_frame((255, 0, 0)))
+        path = str(tmp_path / "frames.npz")
+        frame_set.save(path)
+
+        loaded = FrameSet.load(path)
+        assert loaded.timestamps == [1.25]
+        assert tuple(loaded.frames[0][5, 5]) == (255, 0, 0)
+
+
+class TestCompareFrames:
+    """Test cases for perceptual diffing."""
+
+    def test_identical(self):
+        """Test that equal frames have no bad pixels."""
+        diff = compare_frames(make_frame((10, 20, 30)), make_frame((10, 20, 30)))
+        assert diff.bad_pixels == 0
+        assert diff.bbox is None
+
+    def test_small_shift_within_tolerance(self):
+        """Test that a rounding-level change is tolerated."""
+        diff = compare_frames(make_frame((200, 100, 50)), make_frame((202, 101, 50)))
+        assert diff.bad_pixels == 0
+
+    def test_changed_pixel_reported(self):
+        """Test that a real change is counted and located."""
+        expected = make_frame()
+        actual = make_frame()
+        actual[4, 9] = (255, 255, 255)
+        diff = compare_frames(expected, actual)
+        assert diff.bad_pixels == 1
+        assert diff.bbox == (9, 4, 9, 4)
+
+    def test_green_weighted_more_than_blue(self):
+        """Test that the distance follows perceived difference."""
+        base = make_frame((100, 100, 100))
+        green = compare_frames(base, make_frame((100, 120, 100)), tolerance=0)
+        blue = compare_frames(base, make_frame((100, 100, 120)), tolerance=0)
+        assert green.max_distance > blue.max_distance
+
+
+class TestAssertGolden:
+    """Test cases for golden file checks."""
+
+    def test_records_only_on_request(self, tmp_path, monkeypatch):
+        """Test that a missing file fails until SLDK_UPDATE_GOLDEN records it."""
+        path = str(tmp_path / "scenario.npz")
+        frame_set = FrameSet()
+        frame_set.add(0.0, make_frame((0, 255, 0)))
+
+        monkeypatch.delenv("SLDK_UPDATE_GOLDEN", raising=False)
+        with pytest.raises(AssertionError):
+            assert_golden(frame_set, path)
+        assert not os.path.exists(path)
+
+        monkeypatch.setenv("SLDK_UPDATE_GOLDEN", "1")
+        assert assert_golden(frame_set, path) is False
+        monkeypatch.delenv("SLDK_UPDATE_GOLDEN")
+        assert assert_golden(frame_set, path) is True
+
+    def test_mismatch_raises(self, tmp_path):
+        """Test that a regression fails and keeps the actual frames."""
+        path = str(tmp_path / "scenario.npz")
+        golden = FrameSet()
+        golden.add(0.0, make_frame((0, 255, 0)))
+        golden.save(path)
+
+        changed = FrameSet()
+        changed.add(0.0, make_frame((255, 0, 0)))
+        with pytest.raises(AssertionError):
+            assert_golden(changed, path)
+        assert os.path.exists(str(tmp_path / "scenario.actual.npz"))
+
+
+class TestFrameRecorder:
+    """Test cases for timed capture."""
+
+    def test_capture_at_virtual_times(self):
+        """Test that captures land on the requested timestamps."""
+        import asyncio
+
+        clock = VirtualClock()
+        matrix = LEDMatrix(8, 8, headless=True)
+        recorder = FrameRecorder(matrix, clock)
+
+        async def scenario():
+            for x in range(8):
+                matrix.set_pixel(x, 0, (255, 255, 255))
+                await asyncio.sleep(0.25)
+
+        async def main():
+            await asyncio.gather(scenario(), recorder.capture_at([0.1, 1.1]))
+
+        clock.run(main())
+        frames = recorder.frame_set
+        assert frames.timestamps == [0.1, 1.1]
+        assert np.count_nonzero(frames.frames[0][0, :, 0]) == 1
+        assert np.count_nonzero(frames.frames[1][0, :, 0]) == 5
+
+    def test_display_queue_golden(self, monkeypatch):
+        """Scripted DisplayQueue run checked against a golden file."""
+        import asyncio
+
+        monkeypatch.setenv("SLDK_HEADLESS", "1")
+        from sldk.display import unified
+        from sldk.display.unified import UnifiedDisplay
+        from sldk.display.queue import DisplayQueue
+        from sldk.display.strategy import DisplayItem
+
+        if not unified.LED_SIMULATOR_AVAILABLE:
+            pytest.skip("simulator display stack not importable")
+
+        clock = VirtualClock()
+
+        async def main():
+            display = UnifiedDisplay()
+            await display.initialize()
+            recorder = FrameRecorder(display.matrix, clock)
+
+            queue = DisplayQueue()
+            # Colors stay above 0xFFFF; smaller ints are read as RGB565
+            queue.add_item(DisplayItem('static_text', {'text': 'HELLO', 'x': 2, 'y': 8,
+                                                       'color': 0xFF0000}, duration=1.0))
+            queue.add_item(DisplayItem('static_text', {'text': 'WAIT 45', 'x': 2, 'y': 20,
+                                                       'color': 0xFFFF00}, duration=1.0))
+
+            async def run_queue():
+                for _ in range(40):
+                    await queue.process_next(display)
+                    await display.show()
+                    await asyncio.sleep(1 / 20)
+
+            await asyncio.gather(run_queue(), recorder.capture_at([0.5, 1.5]))
+            return recorder.frame_set
+
+        frame_set = clock.run(main())
+        if not assert_golden(frame_set, os.path.join(GOLDEN_DIR, 'display_queue_text.npz')):
+            pytest.skip("golden frames recorded")
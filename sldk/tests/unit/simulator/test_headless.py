@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""Unit tests for the virtual clock and headless simulator backend."""
+
+import pytest
+import sys
+import os
+import asyncio
+import time
+
+np = pytest.importorskip("numpy")
+pytest.importorskip("pygame")
+
+# Add path to enable sldk imports
+sldk_src_path = os.path.join(os.path.dirname(__file__), '../../../src')
+if sldk_src_path not in sys.path:
+    sys.path.insert(0, sldk_src_path)
+
+from sldk.simulator.core import VirtualClock, LEDMatrix
+from sldk.simulator.devices import MatrixPortalS3
+from sldk.simulator import displayio
+
+
+class TestVirtualClock:
+    """Test cases for VirtualClock."""
+
+    def test_tick_has_no_drift(self):
+        """Test that an hour of 60 FPS ticks lands exactly on the hour."""
+        clock = VirtualClock()
+        for _ in range(60 * 3600):
+            clock.tick(60)
+        assert clock.monotonic_ns() == 3600 * 1000000000
+        assert clock.frame == 60 * 3600
+
+    def test_patch_restores_time(self):
+        """Test that patched time functions are restored afterwards."""
+        real_sleep = time.sleep
+        clock = VirtualClock(start=100.0)
+        with clock.patch():
+            time.sleep(5)
+            assert time.monotonic() == 105.0
+        assert time.sleep is real_sleep
+
+    def test_asyncio_sleep_is_virtual(self):
+        """Test that concurrent sleeps interleave in virtual time."""
+        clock = VirtualClock()
+        log = []
+
+        async def ticker(name, interval, count):
+            for _ in range(count):
+                await asyncio.sleep(interval)
+                log.append((name, round(time.monotonic(), 6)))
+
+        async def main():
+            await asyncio.gather(ticker("a", 0.5, 2), ticker("b", 0.3, 3))
+
+        started = time.perf_counter()
+        clock.run(main())
+        assert time.perf_counter() - started < 0.5
+        assert log == [("b", 0.3), ("a", 0.5), ("b", 0.6), ("b", 0.9), ("a", 1.0)]
+        assert clock.monotonic() == pytest.approx(1.0)
+
+    def test_reveal_effect_runs_in_virtual_time(self):
+        """Test that a multi-second effect completes without waiting."""
+        from sldk.effects.reveal import RevealEffect
+
+        class StubDisplay:
+            width = 64
+            height = 32
+            shows = 0
+
+            async def clear(self):
+                pass
+
+            async def show(self):
+                StubDisplay.shows += 1
+
+        async def render():
+            pass
+
+        clock = VirtualClock()
+        effect = RevealEffect(duration=2.0, pause_at_end=1.0)
+        started = time.perf_counter()
+        clock.run(effect.apply(StubDisplay(), render))
+        assert time.perf_counter() - started < 1.0
+        assert clock.monotonic() == pytest.approx(3.0)
+        assert StubDisplay.shows == 65
+
+
+class TestHeadlessBackend:
+    """Test cases for headless rendering."""
+
+    def test_headless_matrix_has_no_surface(self):
+        """Test that a headless matrix never rasterizes on render."""
+        matrix = LEDMatrix(8, 8, headless=True)
+        matrix.set_pixel(1, 1, (255, 0, 0))
+        assert matrix.render() == []
+        assert matrix.surface is None
+        assert not matrix.pixel_buffer.is_dirty()
+        assert tuple(matrix.get_frame()[1, 1]) == (255, 0, 0)
+
+    def test_headless_surface_on_demand(self):
+        """Test that get_surface() still produces the LED rendering."""
+        matrix = LEDMatrix(8, 8, headless=True)
+        surface = matrix.get_surface()
+        assert surface.get_size() == (matrix.surface_width, matrix.surface_height)
+
+    def test_device_run_advances_exact_frames(self):
+        """Test that a headless device loop runs on frame steps."""
+        device = MatrixPortalS3(headless=True)
+        device.initialize()
+
+        bitmap = displayio.Bitmap(1, 1, 2)
+        palette = displayio.Palette(2)
+        palette[1] = 0xFFFFFF
+        tile = displayio.TileGrid(bitmap, pixel_shader=palette)
+        device.show(tile)
+
+        times = []
+
+        def update():
+            times.append(time.monotonic())
+            bitmap[0, 0] = len(times) % 2
+            device.refresh()
+
+        device.run(update, frames=120)
+        assert len(times) == 120
+        assert times[1] - times[0] == pytest.approx(1 / 60)
+        assert device.clock.monotonic() == pytest.approx(2.0)
+        assert tuple(device.matrix.get_frame()[0, 0]) == (0, 0, 0)
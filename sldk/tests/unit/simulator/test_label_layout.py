@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Unit tests for vectorized Label layout."""
+
+import pytest
+import sys
+import os
+
+np = pytest.importorskip("numpy")
+pytest.importorskip("pygame")
+
+# Add path to enable sldk imports
+sldk_src_path = os.path.join(os.path.dirname(__file__), '../../../src')
+if sldk_src_path not in sys.path:
+    sys.path.insert(0, sldk_src_path)
+
+from sldk.simulator.adafruit_bitmap_font.bitmap_font import load_font
+from sldk.simulator.adafruit_display_text.label import Label
+
+
+@pytest.fixture
+def font():
+    """Load the bundled tom-thumb font."""
+    return load_font("tom-thumb.bdf")
+
+
+class TestShapedRuns:
+    """Test cases for GlyphAtlas.shape."""
+    
+    def test_cache_hit_returns_same_run(self, font):
+        """Test that shaping a repeated string is a lookup."""
+        run = font.atlas.shape("Closed")
+        assert font.atlas.shape("Closed") is run
+        assert not run.mask.flags.writeable
+        
+    def test_advance_matches_glyph_metrics(self, font):
+        """Test that the run advance is the sum of glyph advances."""
+        run = font.atlas.shape("AB C")
+        expected = sum(font.get_glyph(c)['dx'] for c in "AB C")
+        assert run.advance == expected
+        
+    def test_glyph_placement(self, font):
+        """Test that each glyph lands at its pen position."""
+        run = font.atlas.shape("AA")
+        glyph = font.atlas.glyph_pixels(font.atlas.index('A'))
+        height, width = glyph.shape
+        dx = int(font.atlas.dx[font.atlas.index('A')])
+        assert np.array_equal(run.mask[:height, :width], glyph)
+        assert np.array_equal(run.mask[:height, dx - run.left:dx - run.left + width], glyph)
+
+
+class TestLabelLayout:
+    """Test cases for Label rasterization."""
+    
+    def test_pixels_match_shaped_run(self, font):
+        """Test that the label bitmap holds the run at the baseline."""
+        label = Label(font, text="Hi", padding_left=1)
+        run = font.atlas.shape("Hi")
+        rows, cols = run.mask.shape
+        top = font.ascent + run.top
+        left = 1 + run.left
+        buffer = label._bitmap._buffer
+        assert np.array_equal(buffer[top:top + rows, left:left + cols], run.mask)
+        assert buffer.sum() == run.mask.sum()
+        
+    def test_shorter_text_reuses_bitmap(self, font):
+        """Test that a transparent label keeps its bitmap when text shrinks."""
+        label = Label(font, text="Space Mountain")
+        bitmap = label._bitmap
+        tilegrid = label._tilegrid
+        label.text = "Closed"
+        assert label._bitmap is bitmap
+        assert label._tilegrid is tilegrid
+        assert label.width == font.atlas.shape("Closed").advance
+        # Nothing from the old text survives
+        assert bitmap._buffer[:, label.width:].sum() == 0
+        
+    def test_longer_text_grows_bitmap(self, font):
+        """Test that text wider than the bitmap gets a new one."""
+        label = Label(font, text="Open")
+        label.text = "Temporarily Closed"
+        assert label._bitmap.width >= label.width
+        assert len(label) == 1
+        
+    def test_background_needs_exact_size(self, font):
+        """Test that an opaque background is never larger than the text."""
+        label = Label(font, text="Space Mountain", background_color=0x0000FF)
+        label.text = "Closed"
+        assert label._bitmap.width == label.width
+        
+    def test_multiline(self, font):
+        """Test that each line is drawn one line step lower."""
+        label = Label(font, text="A\nA", line_spacing=1.0)
+        run = font.atlas.shape("A")
+        rows, cols = run.mask.shape
+        step = int(font.height * 1.0)
+        buffer = label._bitmap._buffer
+        for line in range(2):
+            top = font.ascent + run.top + line * step
+            assert np.array_equal(buffer[top:top + rows, run.left:run.left + cols], run.mask)
+        assert label.height == font.ascent + font.descent + step
+        
+    def test_color_change_keeps_palette(self, font):
+        """Test that recoloring does not rebuild the label."""
+        label = Label(font, text="Wait")
+        palette = label._palette
+        label.color = 0xF800
+        assert label._palette is palette
+        assert palette[1] == 0xF800
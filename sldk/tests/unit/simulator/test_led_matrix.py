@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Unit tests for the vectorized LED matrix renderer."""
+
+import pytest
+import sys
+import os
+
+np = pytest.importorskip("numpy")
+pytest.importorskip("pygame")
+
+# Add path to enable sldk imports
+sldk_src_path = os.path.join(os.path.dirname(__file__), '../../../src')
+if sldk_src_path not in sys.path:
+    sys.path.insert(0, sldk_src_path)
+
+from sldk.simulator.core.led_matrix import LEDMatrix
+
+
+class TestLEDMatrixRasterize:
+    """Test cases for LEDMatrix.rasterize."""
+
+    def _led_center(self, matrix, x, y):
+        """Surface coordinates of an LED center."""
+        step = matrix.led_size + matrix.spacing
+        return (y * step + matrix.led_size // 2, x * step + matrix.led_size // 2)
+
+    def test_full_frame_shape(self):
+        """Test that a full rasterize covers the whole surface."""
+        matrix = LEDMatrix(16, 8)
+        frame = matrix.rasterize(0, 0, 16, 8)
+        assert frame.shape == (matrix.surface_height, matrix.surface_width, 3)
+        assert frame.dtype == np.uint8
+
+    def test_off_leds_are_dark_grey(self):
+        """Test that unlit LEDs render as visible grey circles."""
+        matrix = LEDMatrix(4, 4)
+        frame = matrix.rasterize(0, 0, 4, 4)
+        cy, cx = self._led_center(matrix, 1, 1)
+        assert tuple(frame[cy, cx]) == (60, 60, 60)
+        # Spacing between LEDs is background
+        step = matrix.led_size + matrix.spacing
+        assert tuple(frame[0, step - 1]) == (30, 30, 30)
+
+    def test_lit_led_gets_color(self):
+        """Test that a lit LED shows its color with the highlight boost."""
+        matrix = LEDMatrix(4, 4)
+        matrix.set_pixel(2, 3, (50, 0, 150))
+        frame = matrix.rasterize(0, 0, 4, 4)
+        cy, cx = self._led_center(matrix, 2, 3)
+        # 15% boost plus the highlight
+        assert tuple(frame[cy, cx]) == (72, 15, 187)
+
+    def test_brightness_scales_color(self):
+        """Test that brightness is applied to every LED."""
+        matrix = LEDMatrix(4, 4)
+        matrix.fill((200, 200, 200))
+        matrix.set_brightness(0.5)
+        frame = matrix.rasterize(0, 0, 4, 4)
+        cy, cx = self._led_center(matrix, 0, 0)
+        assert tuple(frame[cy, cx]) == (115, 115, 115)
+
+    def test_partial_block_matches_full_frame(self):
+        """Test that a sub-block rasterizes identically to the full frame."""
+        matrix = LEDMatrix(8, 8)
+        matrix.set_pixel(3, 4, (255, 128, 0))
+        matrix.set_pixel(5, 5, (0, 255, 0))
+        full = matrix.rasterize(0, 0, 8, 8)
+
+        step = matrix.led_size + matrix.spacing
+        block = matrix.rasterize(2, 3, 6, 6)
+        expected = full[3 * step:6 * step, 2 * step:6 * step]
+        assert block.shape == expected.shape
+        assert np.array_equal(block, expected)
+
+
+class TestLEDMatrixPartialRender:
+    """Test cases for dirty-rectangle rendering."""
+
+    def test_render_only_dirty_block(self):
+        """Test that a single changed pixel redraws a single LED area."""
+        matrix = LEDMatrix(16, 8)
+        matrix.render()
+        matrix.present(matrix.get_surface())
+
+        matrix.set_pixel(5, 2, (255, 0, 0))
+        rects = matrix.render()
+        step = matrix.led_size + matrix.spacing
+        assert len(rects) == 1
+        assert rects[0].topleft == (5 * step, 2 * step)
+        assert rects[0].width == step
+
+    def test_clean_render_is_empty(self):
+        """Test that rendering with no changes does nothing."""
+        matrix = LEDMatrix(16, 8)
+        matrix.render()
+        assert matrix.render() == []
+
+    def test_present_offsets_damage(self):
+        """Test that present() reports target-space rectangles once."""
+        import pygame
+
+        matrix = LEDMatrix(16, 8)
+        target = pygame.Surface((matrix.surface_width + 20, matrix.surface_height + 10))
+        matrix.present(target, (20, 10))
+
+        matrix.set_pixel(0, 0, (0, 255, 0))
+        rects = matrix.present(target, (20, 10))
+        assert rects[0].topleft == (20, 10)
+        assert matrix.present(target, (20, 10)) == []
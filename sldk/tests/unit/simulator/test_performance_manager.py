@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Unit tests for the simulator hardware timing model."""
+
+import pytest
+import sys
+import os
+
+pytest.importorskip("numpy")
+pytest.importorskip("pygame")
+
+# Add path to enable sldk imports
+sldk_src_path = os.path.join(os.path.dirname(__file__), '../../../src')
+if sldk_src_path not in sys.path:
+    sys.path.insert(0, sldk_src_path)
+
+from sldk.simulator.core.performance_manager import PerformanceManager, PROFILES
+
+
+def make_manager(**kwargs):
+    """Create a manager that records sleeps instead of sleeping."""
+    slept = []
+    manager = PerformanceManager(sleep=slept.append, **kwargs)
+    return manager, slept
+
+
+class TestPerformanceManager:
+    """Test cases for PerformanceManager."""
+
+    def test_defaults_to_esp32_s3(self):
+        """Test that the default profile models the MatrixPortal S3."""
+        manager, _ = make_manager()
+        assert manager.hardware_profile == "ESP32-S3"
+        assert manager.profile["cpu_mhz"] == 240
+
+    def test_unknown_profile_rejected(self):
+        """Test that a typo in the profile name fails loudly."""
+        with pytest.raises(ValueError):
+            PerformanceManager("ESP32-S4")
+        with pytest.raises(ValueError):
+            PerformanceManager(instruction_uss=1.0)
+
+    def test_pixel_writes_charge_time(self):
+        """Test that instruction cost scales with count."""
+        manager, _ = make_manager(realtime=False)
+        manager.simulate_instruction_delay(1000)
+        assert manager.total_us == pytest.approx(1000 * PROFILES["ESP32-S3"]["instruction_us"])
+
+    def test_refresh_cost_scales_with_pixels(self):
+        """Test that a partial refresh is cheaper than a full one."""
+        manager, _ = make_manager(realtime=False)
+        manager.simulate_io_operation("display_refresh", pixels=64)
+        partial = manager.total_us
+        manager.reset()
+        manager.simulate_io_operation("display_refresh", pixels=64 * 32)
+        assert manager.total_us > partial
+        assert manager.stats["refreshes"] == 1
+
+    def test_gc_pause_after_heap_threshold(self):
+        """Test that filling the heap triggers a collection pause."""
+        manager, _ = make_manager(realtime=False, heap_bytes=10000)
+        manager.simulate_gc_pause()
+        assert manager.stats["gc_collections"] == 0
+
+        manager.simulate_memory_constraint(8000)
+        manager.simulate_gc_pause()
+        assert manager.stats["gc_collections"] == 1
+        assert manager.heap_used < 8000
+        assert manager.stats["gc_us"] > 0
+
+    def test_allocation_larger_than_heap(self):
+        """Test that an impossible allocation raises MemoryError."""
+        manager, _ = make_manager(realtime=False, heap_bytes=1024)
+        with pytest.raises(MemoryError):
+            manager.simulate_memory_constraint(4096)
+
+    def test_http_keep_alive_skips_handshake(self):
+        """Test that a reused connection avoids connect and TLS latency."""
+        manager, _ = make_manager(realtime=False)
+        cold = manager.simulate_http_request(10000)
+        warm = manager.simulate_http_request(10000, reuse_connection=True)
+        assert cold - warm == pytest.approx(
+            (PROFILES["ESP32-S3"]["http_connect_ms"] + PROFILES["ESP32-S3"]["http_tls_ms"]) / 1000)
+
+    def test_frame_budget(self):
+        """Test frame accounting against the S3's real frame budgets."""
+        profile = PROFILES["ESP32-S3"]
+        pixels = 64 * 32
+        manager, slept = make_manager()
+        manager.begin_frame()
+        # Redraw every pixel from Python, about ten operations each
+        manager.simulate_instruction_delay(pixels * 10)
+        manager.simulate_io_operation("display_refresh", pixels=pixels)
+        frame_time = manager.end_frame()
+
+        expected_us = (pixels * 10 * profile["instruction_us"]
+                       + profile["refresh_overhead_us"] + pixels * profile["refresh_pixel_us"])
+        assert frame_time == pytest.approx(expected_us / 1000000)
+        assert sum(slept) == pytest.approx(frame_time)
+        assert manager.estimated_fps() == pytest.approx(1 / frame_time)
+        # About 35 ms: inside a 20 FPS budget, past a 30 FPS one
+        assert manager.can_hold(20)
+        assert not manager.can_hold(30)
+
+    def test_disabled_charges_nothing(self):
+        """Test that a disabled manager is free."""
+        manager, slept = make_manager()
+        manager.enabled = False
+        manager.simulate_instruction_delay(10000)
+        manager.simulate_io_operation("display_refresh", pixels=2048)
+        assert manager.total_us == 0
+        assert slept == []
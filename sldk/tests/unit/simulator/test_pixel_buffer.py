@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""Unit tests for PixelBuffer dirty-rectangle tracking."""
+
+import pytest
+import sys
+import os
+
+np = pytest.importorskip("numpy")
+
+# Add path to enable sldk imports
+sldk_src_path = os.path.join(os.path.dirname(__file__), '../../../src')
+if sldk_src_path not in sys.path:
+    sys.path.insert(0, sldk_src_path)
+
+from sldk.simulator.core.pixel_buffer import PixelBuffer
+
+
+class TestPixelBufferDirtyRects:
+    """Test cases for dirty-rectangle tracking."""
+
+    def test_new_buffer_is_fully_dirty(self):
+        """Test that a new buffer reports a full redraw."""
+        buffer = PixelBuffer(64, 32)
+        assert buffer.is_dirty()
+        assert buffer.get_dirty_rects() is None
+
+    def test_separate_writes_stay_separate(self):
+        """Test that distant writes produce distinct rectangles."""
+        buffer = PixelBuffer(64, 32)
+        buffer.clear_dirty()
+        buffer.set_pixel(1, 1, (255, 0, 0))
+        buffer.set_pixel(60, 30, (0, 255, 0))
+        assert buffer.get_dirty_rects() == [(1, 1, 1, 1), (60, 30, 60, 30)]
+        assert buffer.get_dirty_region() == (1, 1, 60, 30)
+
+    def test_adjacent_writes_merge(self):
+        """Test that touching writes merge into one rectangle."""
+        buffer = PixelBuffer(64, 32)
+        buffer.clear_dirty()
+        for x in range(10, 20):
+            buffer.set_pixel(x, 5, (255, 255, 255))
+        assert buffer.get_dirty_rects() == [(10, 5, 19, 5)]
+
+    def test_writes_after_full_dirty_stay_full(self):
+        """Test that a partial write does not shrink a full redraw."""
+        buffer = PixelBuffer(64, 32)
+        buffer.clear_dirty()
+        buffer.fill((10, 10, 10))
+        buffer.set_pixel(3, 3, (255, 0, 0))
+        assert buffer.get_dirty_rects() is None
+
+    def test_too_many_rects_collapse(self):
+        """Test that the rectangle list is bounded."""
+        buffer = PixelBuffer(64, 32)
+        buffer.clear_dirty()
+        for i in range(PixelBuffer.MAX_DIRTY_RECTS + 1):
+            buffer.set_pixel(i * 3, 0, (255, 0, 0))
+        assert len(buffer.get_dirty_rects()) <= PixelBuffer.MAX_DIRTY_RECTS
+
+    def test_load_frame_marks_only_changed_tiles(self):
+        """Test that loading a frame dirties only the tiles that differ."""
+        buffer = PixelBuffer(64, 32)
+        buffer.clear_dirty()
+
+        frame = np.zeros((32, 64, 3), dtype=np.uint8)
+        frame[2, 3] = (255, 0, 0)
+        frame[30, 62] = (0, 0, 255)
+        assert buffer.load_frame(frame) == 2
+        assert buffer.get_dirty_rects() == [(0, 0, 7, 7), (56, 24, 63, 31)]
+        assert buffer.get_pixel(3, 2) == (255, 0, 0)
+
+    def test_load_identical_frame_is_clean(self):
+        """Test that an unchanged frame leaves the buffer clean."""
+        buffer = PixelBuffer(64, 32)
+        buffer.clear_dirty()
+        assert buffer.load_frame(buffer.get_buffer().copy()) == 0
+        assert not buffer.is_dirty()
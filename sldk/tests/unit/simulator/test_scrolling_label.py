@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Unit tests for strip-based ScrollingLabel."""
+
+import pytest
+import sys
+import os
+
+np = pytest.importorskip("numpy")
+pytest.importorskip("pygame")
+
+# Add path to enable sldk imports
+sldk_src_path = os.path.join(os.path.dirname(__file__), '../../../src')
+if sldk_src_path not in sys.path:
+    sys.path.insert(0, sldk_src_path)
+
+from sldk.simulator.adafruit_bitmap_font.bitmap_font import load_font
+from sldk.simulator.adafruit_display_text.label import Label
+from sldk.simulator.adafruit_display_text.scrolling_label import ScrollingLabel
+
+
+@pytest.fixture
+def font():
+    """Load the bundled tom-thumb font."""
+    return load_font("tom-thumb.bdf")
+
+
+class TestScrollingLabel:
+    """Test cases for ScrollingLabel."""
+    
+    def test_short_text_is_static(self, font):
+        """Test that text within max_characters renders like a Label."""
+        scrolling = ScrollingLabel(font, text="Open", max_characters=10)
+        plain = Label(font, text="Open")
+        assert np.array_equal(scrolling._bitmap._buffer, plain._bitmap._buffer)
+        
+    def test_character_steps_match_sliced_text(self, font):
+        """Test that each step shows the same pixels as the sliced text."""
+        text = "ABCDEFGH"
+        scrolling = ScrollingLabel(font, text=text, max_characters=4)
+        for index in range(len(text)):
+            assert scrolling.text == (text + text)[index:index + 4]
+            plain = Label(font, text=scrolling.text)
+            width = plain._bitmap.width
+            assert np.array_equal(scrolling._bitmap._buffer[:, :width],
+                                  plain._bitmap._buffer)
+            scrolling.scroll()
+        assert scrolling.current_index == 0
+        
+    def test_strip_is_reused(self, font):
+        """Test that scrolling never rebuilds the strip or bitmap."""
+        scrolling = ScrollingLabel(font, text="Space Mountain", max_characters=5)
+        strip = scrolling._strip
+        bitmap = scrolling._bitmap
+        for _ in range(20):
+            scrolling.scroll()
+        assert scrolling._strip is strip
+        assert scrolling._bitmap is bitmap
+        
+    def test_full_text_rebuilds_strip(self, font):
+        """Test that new text gets a new strip."""
+        scrolling = ScrollingLabel(font, text="Space Mountain", max_characters=5)
+        strip = scrolling._strip
+        scrolling.full_text = "Big Thunder Mountain"
+        assert scrolling._strip is not strip
+        assert scrolling.text == "Big T"
+        
+    def test_smooth_speed_uses_fixed_steps(self, font, monkeypatch):
+        """Test that smooth scrolling follows the clock and catches up."""
+        now = [100.0]
+        monkeypatch.setattr("time.monotonic", lambda: now[0])
+        scrolling = ScrollingLabel(font, text="Space Mountain", max_characters=5,
+                                   speed=7.5)
+        scrolling.start_scrolling()
+        
+        # Sub-pixel progress is carried, not dropped
+        now[0] += 0.1
+        assert scrolling.update() is False
+        now[0] += 0.1
+        assert scrolling.update() is True
+        assert int(scrolling._offset) == 1
+        
+        # One slow frame advances as far as several short ones
+        now[0] += 0.24
+        scrolling.update()
+        assert int(scrolling._offset) == 3
+        
+        # Stalls beyond max_catchup (0.25s) don't skip ahead
+        now[0] += 10.0
+        scrolling.update()
+        assert int(scrolling._offset) == 5
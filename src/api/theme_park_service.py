@@ -5,35 +5,84 @@ Copyright 2024 3DUPFitters LLC
 import asyncio
 import json
 
+from src.models.ride_table import RideTable
 from src.models.theme_park import ThemePark
 from src.models.theme_park_list import ThemeParkList
 from src.models.vacation import Vacation
 from src.config.settings_manager import SettingsManager
+from src.network.http_client import BaseResponse, HTTP_NOT_MODIFIED
+from src.network.fetch_scheduler import FetchScheduler
 from src.utils.error_handler import ErrorHandler
 
 # Initialize logger
 logger = ErrorHandler("error_log")
 
+# Returned by fetch_park_data when the server reports the park data unchanged
+NOT_MODIFIED = object()
+
+# Bytes read from the socket at a time when streaming a response body
+STREAM_CHUNK_SIZE = 512
+
+# Host serving the park list and wait times
+QUEUE_TIMES_HOST = "queue-times.com"
+
+# Response cache key for the park list
+PARK_LIST_CACHE_KEY = "parks"
+
+# Cached wait times older than this aren't used once the clock is set
+RIDE_CACHE_MAX_AGE = 12 * 60 * 60
+
 
 class ThemeParkService:
     """
     Service for fetching and managing theme park data
     """
     
-    def __init__(self, http_client, settings_manager):
+    def __init__(self, http_client, settings_manager, cache=None):
         """
         Initialize the theme park service
         
         Args:
             http_client: The HTTP client to use for requests
             settings_manager: The settings manager
+            cache: Optional FlashCache that keeps the last good responses
+                across restarts
         """
         self.http_client = http_client
         self.settings_manager = settings_manager
+        self.cache = cache
         self.park_list = None
         self.vacation = Vacation()
+        # Limits for parallel park fetches; each one holds a TLS socket
+        self.max_concurrent_fetches = 2
+        self.max_fetches_per_host = 2
+        self._scheduler = None
         self.update_needed = False  # Flag to indicate if an update should be forced
+        self.data_changed = True  # Whether the last update brought new park data
+        # Largest mean wait time change per ride (minutes) in the last update
+        self.wait_time_change = 0.0
+        
+    @property
+    def update_needed(self):
+        """Whether an update should be forced on the next cycle"""
+        return self._update_needed
+
+    @update_needed.setter
+    def update_needed(self, needed):
+        """
+        Request or clear a forced update
+        
+        Requesting one (the web server does when settings change) cancels
+        the park fetches of an update in progress, which would be stale.
         
+        Args:
+            needed: True to force an update
+        """
+        self._update_needed = needed
+        if needed and self._scheduler is not None:
+            logger.info("Settings changed, cancelling the park update in progress")
+            self._scheduler.cancel()
+
     async def initialize(self):
         """Initialize the service by fetching park list and setting clock"""
         # Track initialization steps for better error reporting
@@ -97,6 +146,40 @@ class ThemeParkService:
                 self.park_list = ThemeParkList([])
                 logger.info("Created empty park list as failsafe after initialization error")
             
+    def load_cached(self):
+        """
+        Restore the park list and wait times saved by an earlier run
+        
+        Lets the display show the last known data at boot, before the
+        network is up. The regular updates then revalidate it.
+        
+        Returns:
+            True if a park to display has cached rides, False otherwise
+        """
+        if self.cache is None:
+            return False
+        
+        try:
+            park_list = self._load_cached_park_list()
+            if not park_list:
+                return False
+            
+            self.park_list = park_list
+            self.park_list.load_settings(self.settings_manager)
+            self.vacation.load_settings(self.settings_manager)
+            
+            restored = 0
+            for park in self.park_list.selected_parks or [self.park_list.current_park]:
+                if park.is_valid() and self._restore_park(park):
+                    restored += 1
+            
+            logger.info(f"Restored {len(self.park_list.park_list)} parks and rides for {restored} from cache")
+            return restored > 0
+            
+        except Exception as e:
+            logger.error(e, "Error restoring cached park data")
+            return False
+
     async def fetch_park_list(self):
         """
         Fetch the list of theme parks
@@ -114,7 +197,7 @@ class ThemeParkService:
                 
                 response = await self.http_client.get(url)
                 
-                if not response or not hasattr(response, 'text'):
+                if not self._is_response(response):
                     logger.error(None, f"Invalid response when fetching park list (attempt {retry_count + 1})")
                     retry_count += 1
                     await asyncio.sleep(1)
@@ -122,7 +205,7 @@ class ThemeParkService:
                 
                 # Try to parse JSON
                 try:
-                    data = json.loads(response.text)
+                    data = self._parse_response(response, ThemeParkList.parse_stream)
                     if not data:
                         logger.error(None, f"Empty JSON data from park list API (attempt {retry_count + 1})")
                         retry_count += 1
@@ -130,7 +213,9 @@ class ThemeParkService:
                         continue
                     
                     # Create park list
-                    self.park_list = ThemeParkList(data)
+                    park_list = ThemeParkList(data)
+                    self._carry_over_rides(park_list)
+                    self.park_list = park_list
                     
                     # Verify park list has parks
                     if not self.park_list.park_list:
@@ -140,6 +225,8 @@ class ThemeParkService:
                         continue
                     
                     logger.info(f"Successfully fetched {len(self.park_list.park_list)} parks")
+                    if self.cache is not None:
+                        self.cache.save(PARK_LIST_CACHE_KEY, self.park_list.cache_rows())
                     return self.park_list
                     
                 except ValueError as json_error:  # CircuitPython uses ValueError instead of JSONDecodeError
@@ -156,19 +243,35 @@ class ThemeParkService:
         # All retries failed
         logger.error(None, f"Failed to fetch park list after {max_retries} attempts")
         
+        # Fall back to the last good park list
+        if self.cache is not None:
+            if self.park_list and self.park_list.park_list:
+                logger.info("Keeping the current park list")
+                return self.park_list
+            park_list = self._load_cached_park_list()
+            if park_list:
+                logger.info("Using the cached park list")
+                self.park_list = park_list
+                return self.park_list
+        
         # Create empty park list as fallback
         self.park_list = ThemeParkList([])
         return self.park_list
             
-    async def fetch_park_data(self, park_id):
+    async def fetch_park_data(self, park_id, if_modified=False, keep_validators=False):
         """
         Fetch data for a specific park (optimized for speed)
 
         Args:
             park_id: The ID of the park
+            if_modified: Make a conditional request; only use this when the
+                previous response for this park has been applied
+            keep_validators: Remember this response's validators for the next
+                conditional request; only use this when the data will be applied
 
         Returns:
-            Park data as a dictionary, or None if fetch failed
+            Park data as a dictionary, NOT_MODIFIED if the data hasn't changed
+            since the last fetch, or None if fetch failed
         """
         max_retries = 2  # Reduced from 3 to 2
         retry_count = 0
@@ -179,9 +282,23 @@ class ThemeParkService:
                 url = f"https://queue-times.com/parks/{park_id}/queue_times.json"
                 logger.info(f"Fetching data for park ID {park_id} from {url} (attempt {retry_count + 1}/{max_retries})")
 
-                response = await self.http_client.get(url)
-
-                if not response or not hasattr(response, 'text'):
+                if if_modified:
+                    response = await self.http_client.get(url, conditional=True)
+                elif keep_validators and hasattr(self.http_client, 'forget_validators'):
+                    # With nothing to send the server must answer 200, and the
+                    # conditional request keeps that response's validators
+                    self.http_client.forget_validators(url)
+                    response = await self.http_client.get(url, conditional=True)
+                else:
+                    response = await self.http_client.get(url)
+
+                if response and getattr(response, 'status_code', None) == HTTP_NOT_MODIFIED:
+                    logger.debug(f"Park ID {park_id} data not modified")
+                    if hasattr(response, 'close'):
+                        response.close()
+                    return NOT_MODIFIED
+
+                if not self._is_response(response):
                     logger.error(None, f"Invalid response when fetching park data (attempt {retry_count + 1})")
                     retry_count += 1
                     if retry_count < max_retries:
@@ -190,7 +307,7 @@ class ThemeParkService:
 
                 # Try to parse JSON
                 try:
-                    data = json.loads(response.text)
+                    data = self._parse_response(response, ThemePark.parse_stream)
                     if not data:
                         logger.error(None, f"Empty JSON data from park API (attempt {retry_count + 1})")
                         retry_count += 1
@@ -203,6 +320,9 @@ class ThemeParkService:
 
                 except ValueError as json_error:  # CircuitPython uses ValueError instead of JSONDecodeError
                     logger.error(json_error, f"JSON decode error for park data (attempt {retry_count + 1})")
+                    # Don't let a later conditional GET confirm data we never stored
+                    if hasattr(self.http_client, 'forget_validators'):
+                        self.http_client.forget_validators(url)
                     retry_count += 1
                     if retry_count < max_retries:
                         await asyncio.sleep(0.5)  # Reduced from 1s to 0.5s
@@ -230,10 +350,27 @@ class ThemeParkService:
             return False
 
         try:
-            park_data = await self.fetch_park_data(self.park_list.current_park.id)
+            park = self.park_list.current_park
+            self.wait_time_change = 0.0
+            if self._has_ride_data(park):
+                park_data = await self.fetch_park_data(park.id, if_modified=True)
+            else:
+                park_data = await self.fetch_park_data(park.id, keep_validators=True)
+            if park_data is NOT_MODIFIED:
+                self.data_changed = False
+                return True
             if park_data:
-                self.park_list.current_park.update(park_data)
+                old_waits = _wait_times(park)
+                park.update(park_data)
+                self._note_wait_time_change(old_waits, park)
+                self._save_park(park)
+                self.data_changed = True
                 return True
+            # Nothing to show yet: fall back to the cached wait times
+            if not self._has_ride_data(park) and self._restore_park(park):
+                self.data_changed = True
+                return True
+            self.data_changed = False
             return False
 
         except Exception as e:
@@ -242,7 +379,11 @@ class ThemeParkService:
             
     async def update_selected_parks(self):
         """
-        Update all selected parks with fresh data (parallel fetching for speed)
+        Update all selected parks with fresh data
+        
+        Parks are fetched in parallel up to max_concurrent_fetches at a
+        time, current park first. Setting update_needed while this runs
+        cancels the parks that haven't started.
         
         Returns:
             Number of parks successfully updated
@@ -255,17 +396,25 @@ class ThemeParkService:
         
         logger.info(f"Starting parallel update of {total_parks} selected parks")
         
-        # Create tasks for all parks to fetch in parallel
-        tasks = []
+        self.wait_time_change = 0.0
+        scheduler = FetchScheduler(self.max_concurrent_fetches, self.max_fetches_per_host)
+        current_park = self.park_list.current_park
         for park in self.park_list.selected_parks:
-            task = asyncio.create_task(self._update_single_park(park))
-            tasks.append(task)
+            scheduler.add(QUEUE_TIMES_HOST,
+                          lambda park=park: self._update_single_park(park),
+                          0 if park is current_park else 1)
         
-        # Wait for all tasks to complete
-        results = await asyncio.gather(*tasks, return_exceptions=True)
+        self._scheduler = scheduler
+        try:
+            results = await scheduler.run()
+        finally:
+            self._scheduler = None
+        if scheduler.cancelled:
+            logger.info("Park update cancelled before all parks were fetched")
         
-        # Count successful updates
-        updated_count = sum(1 for result in results if result is True)
+        # Count successful updates; unchanged parks are up to date too
+        updated_count = sum(1 for result in results if result is True or result is NOT_MODIFIED)
+        self.data_changed = any(result is True for result in results)
         
         logger.info(f"Updated {updated_count}/{total_parks} selected parks")
         return updated_count
@@ -278,22 +427,193 @@ class ThemeParkService:
             park: The park to update
             
         Returns:
-            True if successful, False otherwise
+            True if updated, NOT_MODIFIED if the park data hasn't changed,
+            False otherwise
         """
         try:
             logger.debug(f"Updating park: {park.name} (ID: {park.id})")
-            park_data = await self.fetch_park_data(park.id)
+            if self._has_ride_data(park):
+                park_data = await self.fetch_park_data(park.id, if_modified=True)
+            else:
+                park_data = await self.fetch_park_data(park.id, keep_validators=True)
+            if park_data is NOT_MODIFIED:
+                logger.debug(f"Park data unchanged: {park.name}")
+                return NOT_MODIFIED
             if park_data:
+                old_waits = _wait_times(park)
                 park.update(park_data)
+                self._note_wait_time_change(old_waits, park)
+                self._save_park(park)
                 logger.debug(f"Successfully updated park: {park.name}")
                 return True
             else:
                 logger.error(None, f"Failed to fetch data for park: {park.name}")
+                # Nothing to show yet: fall back to the cached wait times
+                if not self._has_ride_data(park) and self._restore_park(park):
+                    logger.info(f"Using cached wait times for park: {park.name}")
+                    return True
                 return False
         except Exception as e:
             logger.error(e, f"Error updating park: {park.name}")
             return False
 
+    @staticmethod
+    def _is_response(response):
+        """
+        Check that a request returned a usable response
+        
+        Only the status and methods are looked at: text is a property on
+        native adafruit_requests responses, and touching it would read the
+        whole body into heap before it could be streamed.
+        
+        Args:
+            response: The value returned by the HTTP client
+            
+        Returns:
+            True if the response can be parsed
+        """
+        if not response:
+            return False
+        return hasattr(response, 'iter_content') or hasattr(response, 'status_code')
+    
+    def _parse_response(self, response, parse_stream):
+        """
+        Parse a JSON response body, streaming it where possible
+        
+        Native adafruit_requests responses are read from the socket in
+        chunks, so neither the body text nor the full document is ever
+        held in heap. Wrapped responses already hold their body and are
+        streamed from memory. Anything else falls back to json.loads.
+        
+        Args:
+            response: The response to parse
+            parse_stream: Model parser taking a byte source
+            
+        Returns:
+            The parsed data, or an empty dictionary for an HTTP error
+            
+        Raises:
+            ValueError: If the body isn't valid JSON
+        """
+        if isinstance(response, BaseResponse):
+            if response.status_code >= 400:
+                return {}
+            return parse_stream(response.content)
+            
+        if getattr(self.http_client, 'using_adafruit', False) is True and hasattr(response, 'iter_content'):
+            try:
+                if response.status_code >= 400:
+                    return {}
+                return parse_stream(response.iter_content(STREAM_CHUNK_SIZE))
+            finally:
+                response.close()
+                
+        return json.loads(response.text)
+
+    def any_park_open(self):
+        """
+        Check whether any park being shown has an open ride
+        
+        Returns:
+            True if a selected park (or the current park) is open
+        """
+        if not self.park_list:
+            return False
+        parks = self.park_list.selected_parks or [self.park_list.current_park]
+        return any(park.is_valid() and park.is_open for park in parks)
+
+    def _note_wait_time_change(self, old_waits, park):
+        """
+        Record how much a park's wait times moved in an update
+        
+        Args:
+            old_waits: Wait times by ride ID from before the update
+            park: The updated park
+        """
+        new_waits = _wait_times(park)
+        deltas = [abs(wait - old_waits[ride_id])
+                  for ride_id, wait in new_waits.items() if ride_id in old_waits]
+        if deltas:
+            self.wait_time_change = max(self.wait_time_change, sum(deltas) / len(deltas))
+
+    def _load_cached_park_list(self):
+        """
+        Build the park list saved in the cache
+        
+        Returns:
+            A ThemeParkList, or None if nothing usable is cached
+        """
+        rows = self.cache.load(PARK_LIST_CACHE_KEY)
+        if not rows:
+            return None
+        park_list = ThemeParkList.from_cache_rows(rows)
+        return park_list if park_list.park_list else None
+
+    def _save_park(self, park):
+        """
+        Save a park's wait times to the cache
+        
+        Args:
+            park: The park that was just updated
+        """
+        if self.cache is not None and self._has_ride_data(park):
+            self.cache.save(_park_cache_key(park.id), park.cache_rows())
+
+    def _restore_park(self, park):
+        """
+        Load a park's wait times from the cache
+        
+        Args:
+            park: The park to restore
+            
+        Returns:
+            True if cached rides were applied, False otherwise
+        """
+        if self.cache is None:
+            return False
+        rows = self.cache.load(_park_cache_key(park.id), RIDE_CACHE_MAX_AGE)
+        if not rows:
+            return False
+        park.set_cache_rows(rows)
+        return True
+
+    def _carry_over_rides(self, park_list):
+        """
+        Keep the rides already loaded for parks in a refreshed park list
+        
+        Args:
+            park_list: The newly fetched ThemeParkList
+        """
+        if not self.park_list or not isinstance(self.park_list.park_list, list):
+            return
+        loaded = {}
+        for park in self.park_list.park_list:
+            if self._has_ride_data(park):
+                loaded[park.id] = park
+        if not loaded:
+            return
+        for park in park_list.park_list:
+            old_park = loaded.get(park.id)
+            if old_park:
+                park.rides = old_park.rides
+                park.is_open = old_park.is_open
+
+    @staticmethod
+    def _has_ride_data(park):
+        """
+        Check whether a park holds data from an earlier fetch
+        
+        Only then can a conditional request's "not modified" be trusted.
+        
+        Args:
+            park: The park to check
+            
+        Returns:
+            True if the park has parsed rides
+        """
+        rides = getattr(park, 'rides', None)
+        return isinstance(rides, (list, RideTable)) and len(rides) > 0
+
     async def get_ride_wait_times(self, park_id=None, ride_name=None):
         """
         Get wait times for rides in a specific park or a specific ride
@@ -497,13 +817,13 @@ class ThemeParkService:
             # Fetch the ride data
             response = await self.http_client.get(url)
             
-            if not response or not hasattr(response, 'text'):
+            if not self._is_response(response):
                 logger.error(None, f"Invalid response when fetching ride data for park ID {park_id}")
                 return []
                 
             # Parse the JSON response
             try:
-                data = json.loads(response.text)
+                data = self._parse_response(response, ThemePark.parse_stream)
                 if not data:
                     logger.error(None, f"Empty JSON data from rides API for park ID {park_id}")
                     return []
@@ -527,4 +847,19 @@ class ThemeParkService:
                 
         except Exception as e:
             logger.error(e, f"Error fetching rides for park ID {park_id}")
-            return []
\ No newline at end of file
+            return []
+
+
+def _park_cache_key(park_id):
+    """Get the response cache key for a park's wait times"""
+    return f"park_{park_id}"
+
+
+def _wait_times(park):
+    """Get a park's numeric wait times by ride ID"""
+    rides = getattr(park, 'rides', None)
+    if isinstance(rides, RideTable):
+        return rides.wait_times_by_id()
+    if not isinstance(rides, list):
+        return {}
+    return {ride.id: ride.wait_time for ride in rides if isinstance(ride.wait_time, int)}
@@ -13,6 +13,8 @@ from src.api.theme_park_service import ThemeParkService
 from src.ui.message_queue import MessageQueue
 from src.utils.error_handler import ErrorHandler
 from src.utils.timer import Timer
+from src.utils.flash_cache import FlashCache
+from src.utils.poll_interval import AdaptivePollInterval
 from src.network.wifi_manager import WiFiManager
 from src.utils.url_utils import load_credentials
 from src.ui.display_factory import is_dev_mode, is_circuitpython
@@ -45,10 +47,18 @@ class ThemeParkApp:
         self.http_client = http_client
         self.socket_pool = None
         self.settings_manager = settings_manager if settings_manager else SettingsManager("settings.json")
-        self.theme_park_service = ThemeParkService(self.http_client, self.settings_manager)
+        self.theme_park_service = ThemeParkService(self.http_client, self.settings_manager, FlashCache("cache"))
         self.message_queue = MessageQueue(display, 4)
-        self.update_timer = Timer(300)  # Update every 5 minutes
+        self.update_timer = Timer(300)  # Update every 5 minutes to start
+        # Stretches the update interval overnight and while data is unchanged,
+        # shortens it while wait times move quickly
+        self.poll_interval = AdaptivePollInterval(
+            base=300,
+            min_interval=self.settings_manager.get("min_update_interval", 120),
+            max_interval=self.settings_manager.get("max_update_interval", 1800))
         self.wifi_manager = WiFiManager(self.settings_manager)
+        # Set while cached data is on screen during startup
+        self.quiet_startup = False
         
         # Initialize OTA updater
         # Check for pre-release flag in settings for testing
@@ -93,7 +103,8 @@ class ThemeParkApp:
             self.display.set_colors(self.settings_manager)
 
         # Show splash screen first before any network operations
-        await self.display.show_splash(12, True)
+        if not self.quiet_startup:
+            await self.display.show_splash(12, True)
 
         # Create a task for network and data initialization (runs in background)
         # TODO: Figure out how to make the initialization process async to talk to an event-drive display to update users.
@@ -116,6 +127,37 @@ class ThemeParkApp:
         logger.info("Wait times initialized")
         logger.info("All initialization complete")
 
+    async def _initialize_from_cache(self):
+        """
+        Queue up the wait times saved by the last run
+
+        Returns:
+            True if cached data is ready to show, False otherwise
+        """
+        # Without WiFi credentials the setup instructions have to be shown
+        if not self.is_wifi_password_configured():
+            return False
+        if not self.theme_park_service.load_cached():
+            return False
+
+        logger.info("Showing cached wait times while the network starts")
+        self.message_queue.init()
+        await self.build_messages()
+        return True
+
+    async def _show_status(self, message):
+        """
+        Show a startup or update status message
+
+        Suppressed while cached wait times are being shown at startup,
+        so they aren't interrupted by the network coming up.
+
+        Args:
+            message: The message to scroll
+        """
+        if not self.quiet_startup:
+            await self.display.show_scroll_message(message)
+
     async def _initialize_wifi_password(self):
         # Load Current Wifi Password
         ssid, password = load_credentials()
@@ -155,14 +197,14 @@ class ThemeParkApp:
         # Show WiFi connection message with actual SSID
         ssid = self.wifi_manager.ssid
         logger.debug(f"Display implementation type: {type(self.display)}")
-        await self.display.show_scroll_message(f"Connecting to WiFi {ssid}")
+        await self._show_status(f"Connecting to WiFi {ssid}")
 
         # Initialize networking with status updates
         connected = await self.wifi_manager.connect()
 
         # Show appropriate message based on connection result
         if connected:
-            await self.display.show_scroll_message(f"Connected ...")
+            await self._show_status(f"Connected ...")
             # Create HTTP session after WiFi is connected
             if not is_dev_mode():
                 # Only in hardware mode
@@ -183,10 +225,10 @@ class ThemeParkApp:
         else:
             if is_dev_mode():
                 # In dev mode, proceed anyway
-                await self.display.show_scroll_message("Dev mode - continuing without WiFi")
+                await self._show_status("Dev mode - continuing without WiFi")
                 await self._initialize_http_client(None)
             else:
-                await self.display.show_scroll_message("WiFi Failed - Check settings")
+                await self._show_status("WiFi Failed - Check settings")
 
     async def run_configure_wifi_message(self):
         while self.is_wifi_password_configured() is False:
@@ -292,7 +334,7 @@ class ThemeParkApp:
             return
             
         # Takes too much time
-        await self.display.show_scroll_message("Setting time...")
+        await self._show_status("Setting time...")
         try:
             logger.info("Setting system clock...")
             # Get the actual socket pool, not from HTTP client
@@ -371,29 +413,70 @@ class ThemeParkApp:
             num_parks = len(self.theme_park_service.park_list.selected_parks)
             if num_parks == 1:
                 park_name = self.theme_park_service.park_list.selected_parks[0].name
-                await self.display.show_scroll_message(f"Updating {park_name} wait times from queue-times.com...")
+                await self._show_status(f"Updating {park_name} wait times from queue-times.com...")
             else:
-                await self.display.show_scroll_message(f"Updating {num_parks} parks from queue-times.com...")
+                await self._show_status(f"Updating {num_parks} parks from queue-times.com...")
         else:
             park_name = self.theme_park_service.park_list.current_park.name
-            await self.display.show_scroll_message(f"Updating {park_name} wait times from queue-times.com...")
+            await self._show_status(f"Updating {park_name} wait times from queue-times.com...")
 
         # Reset the timer immediately to prevent multiple updates
         self.update_timer.reset()
 
         # Update park data
         if has_selected_parks:
-            await self.theme_park_service.update_selected_parks()
+            updated = await self.theme_park_service.update_selected_parks()
         else:
-            await self.theme_park_service.update_current_park()
+            updated = await self.theme_park_service.update_current_park()
 
-        # Regenerate the message queue
-        self.message_queue.init()
-        await self.build_messages()
+        # Pick the time to the next update from what this one brought
+        self._schedule_next_update(restart=force_update or ignore_timer, failed=not updated)
+
+        # Nothing changed upstream: keep the running queue instead of rebuilding it
+        if (not force_update and not ignore_timer and
+                not getattr(self.theme_park_service, 'data_changed', True)):
+            logger.info("Theme park data not modified, keeping message queue")
+            gc.collect()
+            return
+
+        if force_update:
+            # A settings change such as a new park selection starts over
+            # at the splash instead of carrying the old cursor along
+            self.message_queue.init()
+            await self.build_messages()
+        else:
+            # Merge the new messages into the running queue so the display
+            # carries on from where it is instead of restarting at the splash
+            self.message_queue.begin_rebuild()
+            try:
+                await self.build_messages()
+            finally:
+                self.message_queue.apply_rebuild()
 
         # Force garbage collection to free memory
         gc.collect()
 
+    def _schedule_next_update(self, restart=False, failed=False):
+        """
+        Set the update timer from the adaptive poll interval
+
+        Args:
+            restart: True for the first or a forced update (e.g. after a
+                settings change), which starts over from the base interval
+            failed: True when no park could be updated, which retries at
+                the base interval instead of backing off
+        """
+        service = self.theme_park_service
+        if restart:
+            self.poll_interval.reset()
+        delay = self.poll_interval.update(
+            changed=getattr(service, 'data_changed', True),
+            active=service.any_park_open() if hasattr(service, 'any_park_open') else True,
+            change_rate=getattr(service, 'wait_time_change', 0.0),
+            failed=failed)
+        self.update_timer.target_length = delay
+        logger.debug(f"Next data update in {int(delay)}s")
+
     async def build_messages(self):
         """Build the message queue for displaying information"""
 
@@ -581,8 +664,11 @@ class ThemeParkApp:
         """Run the display update loop"""
         while True:
             try:
-                # Update data if needed
-                await self.update_data(False)
+                # Update data if needed; during a cached startup
+                # initialize_all() does the update, and two rebuilds
+                # mustn't interleave on the staged queue
+                if not self.quiet_startup:
+                    await self.update_data(False)
 
                 # Show the next message in the queue
                 await self.message_queue.show()
@@ -671,7 +757,19 @@ class ThemeParkApp:
 
     async def run(self):
         """Run the main application loop with concurrent tasks"""
-        await self.initialize_all()
+        # Render the last known wait times right away and revalidate them
+        # while the network comes up
+        display_task = None
+        if await self._initialize_from_cache():
+            self.quiet_startup = True
+            self.update_timer.reset()
+            display_task = asyncio.create_task(self.run_display_loop())
+
+        try:
+            await self.initialize_all()
+        finally:
+            self.quiet_startup = False
+        display_loop = display_task if display_task else self.run_display_loop()
 
         # Start web server (will use appropriate implementation based on mode)
         web_server = None
@@ -689,18 +787,18 @@ class ThemeParkApp:
             if is_dev_mode():
                 # In dev mode, web server runs in its own thread, so we only need the display loop
                 logger.info("Development mode: Running display loop with threaded web server")
-                await self.run_display_loop()
+                await display_loop
             else:
                 # In hardware mode, run both loops concurrently
                 logger.info("Hardware mode: Starting display and web server concurrently")
                 await asyncio.gather(
-                    self.run_display_loop(),
+                    display_loop,
                     self.run_web_server_loop(web_server)
                 )
         else:
             # Just run the display loop if no web server
             logger.info("Running display loop only (no web server)")
-            await self.run_display_loop()
+            await display_loop
 
     @staticmethod
     def is_wifi_password_configured() -> bool:
@@ -94,8 +94,8 @@ async def main():
             # For non-hardware testing or dev mode
             from src.network.http_client import HttpClient
             
-            # Create HTTP client
-            http_client = HttpClient()
+            # Create HTTP client; reuse connections across refreshes
+            http_client = HttpClient(keep_alive=True)
             
             # Set up special handling for simulator display
             if is_dev_mode():
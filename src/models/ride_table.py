@@ -0,0 +1,215 @@
+"""
+Packed storage for the rides at a theme park.
+Copyright 2024 3DUPFitters LLC
+"""
+from array import array
+
+from src.models.theme_park_ride import ThemeParkRide
+
+# Largest value an unsigned short array entry holds
+MAX_SHORT = 0xFFFF
+
+
+class RideView(ThemeParkRide):
+    """One row of a RideTable, read through the ThemeParkRide interface"""
+
+    def __init__(self, table, index):
+        """
+        Initialize the view
+
+        Args:
+            table: The RideTable holding the ride
+            index: The ride's row in the table
+        """
+        self.table = table
+        self.index = index
+
+    @property
+    def name(self):
+        return self.table.names[self.index]
+
+    @property
+    def id(self):
+        return self.table.ids[self.index]
+
+    @property
+    def wait_time(self):
+        return self.table.wait_times[self.index]
+
+    @property
+    def open_flag(self):
+        return self.table.open_flag(self.index)
+
+
+class RideTable:
+    """
+    The rides at a park stored as parallel arrays
+
+    A ride is a row index. Ids and wait times are unsigned short arrays,
+    open flags are bits in a bytearray, and names are a list of strings
+    that can share its string objects with the park's previous table.
+    Showing four parks of 40+ rides this way allocates a handful of
+    objects per park instead of one object per ride.
+
+    Indexing or iterating the table gives RideView objects for code
+    written against ThemeParkRide. The message queue sorts and filters
+    row indices directly with select() and sort_key().
+    """
+
+    def __init__(self):
+        """Initialize an empty table"""
+        self.names = []
+        self.ids = array('H')
+        self.wait_times = array('H')
+        self.open_flags = bytearray()
+
+    @classmethod
+    def from_rides(cls, rides):
+        """
+        Build a table from ride objects
+
+        Args:
+            rides: Iterable of objects with name, id, wait_time and open_flag
+
+        Returns:
+            A RideTable
+        """
+        table = cls()
+        for ride in rides:
+            table.append(ride.name, ride.id, ride.wait_time, ride.open_flag)
+        return table
+
+    def append(self, name, ride_id, wait_time, open_flag):
+        """
+        Add a ride
+
+        Args:
+            name: The name of the ride
+            ride_id: The ID of the ride
+            wait_time: The current wait time in minutes
+            open_flag: Whether the ride is currently open
+        """
+        index = len(self.names)
+        ride_id = _to_unsigned(ride_id)
+        if ride_id > MAX_SHORT and self.ids.typecode == 'H':
+            # Ids have fit in 16 bits so far; widen rather than truncate
+            self.ids = array('L', self.ids)
+        self.names.append(name)
+        self.ids.append(ride_id)
+        self.wait_times.append(min(_to_unsigned(wait_time), MAX_SHORT))
+        if index % 8 == 0:
+            self.open_flags.append(0)
+        if open_flag is True:
+            self.open_flags[index >> 3] |= 1 << (index & 7)
+
+    def open_flag(self, index):
+        """
+        Get the feed's open flag for a ride
+
+        Args:
+            index: The ride's row
+
+        Returns:
+            True if the feed marks the ride open
+        """
+        return bool(self.open_flags[index >> 3] & (1 << (index & 7)))
+
+    def is_open(self, index):
+        """
+        Check if a ride is open, the same way ThemeParkRide.is_open() does
+
+        Args:
+            index: The ride's row
+
+        Returns:
+            True if the ride is marked open and has a wait time
+        """
+        return self.open_flag(index) and self.wait_times[index] > 0
+
+    def select(self, skip_meet=False, skip_closed=False):
+        """
+        Get the rows that pass the display filters
+
+        Args:
+            skip_meet: Whether to leave out meet & greet attractions
+            skip_closed: Whether to leave out closed rides
+
+        Returns:
+            List of row indices in table order
+        """
+        rows = []
+        for index in range(len(self.names)):
+            if skip_meet and "Meet" in self.names[index]:
+                continue
+            if skip_closed and not self.is_open(index):
+                continue
+            rows.append(index)
+        return rows
+
+    def sort_key(self, sort_mode):
+        """
+        Get a key function that orders row indices for a sort mode
+
+        Args:
+            sort_mode: "alphabetical", "max_wait", or "min_wait"
+
+        Returns:
+            Function taking a row index
+        """
+        if sort_mode in ("max_wait", "min_wait"):
+            # Only truly closed rides (open_flag=False) are treated as 0
+            return lambda index: self.wait_times[index] if self.open_flag(index) else 0
+        # Alphabetical, also the default for unknown sort modes
+        return lambda index: self.names[index].lower()
+
+    @staticmethod
+    def sort_descending(sort_mode):
+        """Check whether a sort mode puts the largest key first"""
+        return sort_mode == "max_wait"
+
+    def share_names(self, other):
+        """
+        Reuse another table's string objects for names both tables hold
+
+        Called with the park's previous table after a refresh, so the
+        new copies of unchanged names can be freed.
+
+        Args:
+            other: The earlier RideTable for the same park
+        """
+        pool = {}
+        for name in other.names:
+            pool[name] = name
+        names = self.names
+        for index in range(len(names)):
+            names[index] = pool.get(names[index], names[index])
+
+    def wait_times_by_id(self):
+        """
+        Get the wait times keyed by ride ID
+
+        Returns:
+            Dictionary of ride ID to wait time in minutes
+        """
+        return dict(zip(self.ids, self.wait_times))
+
+    def __len__(self):
+        return len(self.names)
+
+    def __getitem__(self, index):
+        if index < 0:
+            index += len(self.names)
+        if not 0 <= index < len(self.names):
+            raise IndexError("ride index out of range")
+        return RideView(self, index)
+
+    def __iter__(self):
+        for index in range(len(self.names)):
+            yield RideView(self, index)
+
+
+def _to_unsigned(value):
+    """Get a value as a non-negative int, or 0 if it isn't a number"""
+    if isinstance(value, int) and value > 0:
+        return value
+    return 0
@@ -3,12 +3,16 @@ ThemePark model to represent a theme park with rides.
 Copyright 2024 3DUPFitters LLC
 """
 
-from src.models.theme_park_ride import ThemeParkRide
+from src.models.ride_table import RideTable
 from src.utils.error_handler import ErrorHandler
+from src.utils.json_stream import JsonStream, ANY
 
 # Initialize logger
 logger = ErrorHandler("error_log")
 
+# Ride fields the display uses; everything else in the feed is skipped
+RIDE_FIELDS = ("name", "id", "wait_time", "is_open")
+
 
 class ThemePark:
     """Represents a theme park with rides and wait times"""
@@ -63,19 +67,16 @@ class ThemePark:
         url2 = "/queue_times.json"
         return url1 + str(self.id) + url2
 
-    def _process_ride(self, ride_data):
+    def _process_ride(self, rides, ride_data):
         """
-        Process a single ride's data into a ThemeParkRide object
+        Add a single ride's data to a ride table
         
         Args:
+            rides: The RideTable being built
             ride_data: Dictionary containing ride information
-            
-        Returns:
-            ThemeParkRide object
         """
-        name = self.remove_non_ascii(ride_data["name"])
-        ride_obj = ThemeParkRide(
-            name,
+        rides.append(
+            self.remove_non_ascii(ride_data["name"]),
             ride_data["id"],
             ride_data["wait_time"],
             ride_data["is_open"]
@@ -83,7 +84,6 @@ class ThemePark:
         # Direct check instead of method call for performance
         if ride_data["is_open"]:
             self.is_open = True
-        return ride_obj
 
     def get_rides_from_json(self, json_data):
         """
@@ -93,9 +93,9 @@ class ThemePark:
             json_data: A JSON file containing data for a particular park
             
         Returns:
-            List of ThemeParkRide objects
+            RideTable of the rides
         """
-        ride_list = []
+        ride_list = RideTable()
         self.is_open = False
 
         # Early return for empty data
@@ -109,19 +109,67 @@ class ThemePark:
             for land in lands:
                 land_rides = land.get("rides", [])
                 for ride in land_rides:
-                    ride_list.append(self._process_ride(ride))
+                    self._process_ride(ride_list, ride)
 
             # Process rides not in lands (if they exist)
             # This handles parks without land structure
             direct_rides = json_data.get("rides", [])
             for ride in direct_rides:
-                ride_list.append(self._process_ride(ride))
+                self._process_ride(ride_list, ride)
                 
         except (KeyError, TypeError) as e:
             logger.error(e, "Error parsing theme park data")
             
         return ride_list
 
+    @staticmethod
+    def parse_stream(source):
+        """
+        Read a queue_times.json payload without building the full document
+        
+        Only the ride fields in RIDE_FIELDS are kept, so the result is a
+        small dictionary with the same shape get_rides_from_json() reads.
+        
+        Args:
+            source: bytes, a readable response, or an iterable of byte chunks
+            
+        Returns:
+            Dictionary with "lands" (one entry holding all land rides) and "rides"
+            
+        Raises:
+            ValueError: If the payload isn't valid JSON
+        """
+        land_rides = []
+        direct_rides = []
+        JsonStream(source).collect({
+            ("lands", ANY, "rides", ANY): (RIDE_FIELDS, land_rides.append),
+            ("rides", ANY): (RIDE_FIELDS, direct_rides.append),
+        })
+        return {"lands": [{"rides": land_rides}], "rides": direct_rides}
+
+    def cache_rows(self):
+        """
+        Get the rides in the compact form kept in the response cache
+        
+        Returns:
+            List of [id, name, wait_time, is_open] rows
+        """
+        rides = self.rides
+        if not isinstance(rides, RideTable):
+            rides = RideTable.from_rides(rides)
+        return [[rides.ids[i], rides.names[i], rides.wait_times[i], rides.open_flag(i)]
+                for i in range(len(rides))]
+
+    def set_cache_rows(self, rows):
+        """
+        Set the rides from rows made by cache_rows()
+        
+        Args:
+            rows: List of [id, name, wait_time, is_open] rows
+        """
+        rides = [dict(zip(("id", "name", "wait_time", "is_open"), row)) for row in rows]
+        self.set_rides({"rides": rides})
+
     def is_valid(self):
         """
         Check if this is a valid theme park object
@@ -138,7 +186,7 @@ class ThemePark:
         Args:
             ride_json: JSON data containing ride information
         """
-        self.rides = self.get_rides_from_json(ride_json)
+        self._replace_rides(ride_json)
         self.counter = 0
 
     def get_wait_time(self, ride_name):
@@ -184,7 +232,19 @@ class ThemePark:
         Args:
             json_data: New JSON data for the park
         """
-        self.rides = self.get_rides_from_json(json_data)
+        self._replace_rides(json_data)
+
+    def _replace_rides(self, json_data):
+        """
+        Replace the rides, keeping one copy of names that didn't change
+        
+        Args:
+            json_data: JSON data containing ride information
+        """
+        rides = self.get_rides_from_json(json_data)
+        if isinstance(self.rides, RideTable):
+            rides.share_names(self.rides)
+        self.rides = rides
 
     def get_current_ride_name(self):
         """
@@ -6,6 +6,7 @@ Copyright 2024 3DUPFitters LLC
 from src.utils.error_handler import ErrorHandler
 from src.models.theme_park import ThemePark
 from src.config.settings_manager import SettingsManager
+from src.utils.json_stream import JsonStream, ANY
 
 # Initialize logger
 logger = ErrorHandler("error_log")
@@ -83,6 +84,53 @@ class ThemeParkList:
             logger.error(e, "Error parsing JSON in ThemeParkList initialization")
             # Keep the empty park list
 
+    @staticmethod
+    def parse_stream(source):
+        """
+        Read a parks.json payload without building the full document
+        
+        Only each park's name, id and coordinates are kept, so the large
+        park list fits in heap on the device.
+        
+        Args:
+            source: bytes, a readable response, or an iterable of byte chunks
+            
+        Returns:
+            List in the shape the constructor reads, with a single company
+            holding every park
+            
+        Raises:
+            ValueError: If the payload isn't valid JSON
+        """
+        parks = []
+        JsonStream(source).collect({
+            (ANY, "parks", ANY): (("name", "id", "latitude", "longitude"), parks.append),
+        })
+        return [{"parks": parks}]
+
+    @staticmethod
+    def from_cache_rows(rows):
+        """
+        Build a park list from rows made by cache_rows()
+        
+        Args:
+            rows: List of [id, name, latitude, longitude] rows
+            
+        Returns:
+            A ThemeParkList object
+        """
+        parks = [dict(zip(("id", "name", "latitude", "longitude"), row)) for row in rows]
+        return ThemeParkList([{"parks": parks}])
+
+    def cache_rows(self):
+        """
+        Get the parks in the compact form kept in the response cache
+        
+        Returns:
+            List of [id, name, latitude, longitude] rows
+        """
+        return [[park.id, park.name, park.latitude, park.longitude] for park in self.park_list]
+
     @staticmethod
     def get_park_url_from_id(park_id):
         """
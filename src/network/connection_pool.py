@@ -0,0 +1,223 @@
+"""
+Keep-alive connection pool for the standard library HTTP path.
+Copyright 2024 3DUPFitters LLC
+"""
+import http.client
+import select
+import threading
+import time
+
+from src.utils.error_handler import ErrorHandler
+
+# Initialize logger
+logger = ErrorHandler("error_log")
+
+# Errors raised when the server closed a kept-alive connection
+STALE_CONNECTION_ERRORS = (http.client.RemoteDisconnected, http.client.BadStatusLine,
+                           ConnectionResetError, BrokenPipeError, ConnectionAbortedError)
+
+
+class PooledResponse:
+    """
+    A response whose body has been read so its connection can be reused
+
+    Matches the parts of urllib's response that UrllibResponse reads.
+    """
+
+    def __init__(self, status, headers, content):
+        """
+        Initialize the response
+
+        Args:
+            status: The HTTP status code
+            headers: The response headers (an http.client.HTTPMessage)
+            content: The response body as bytes
+        """
+        self.status = status
+        self.headers = headers
+        self._content = content
+
+    def read(self):
+        """Get the response body"""
+        return self._content
+
+
+class ConnectionPool:
+    """
+    Reuses HTTP/HTTPS connections to the same host across requests
+
+    A refresh fetches several parks from one host, every few minutes,
+    and the TCP and TLS handshakes are most of the cost of each fetch.
+    Connections go back to the pool once their response is read and
+    are reused for the next request to the host. Idle connections are
+    dropped after idle_timeout, and checked before reuse so a
+    connection the server has closed isn't handed out. If a request on
+    a reused connection still fails because the server hung up, it is
+    retried once on a new connection.
+    """
+
+    def __init__(self, max_per_host=2, idle_timeout=60.0, timeout=15):
+        """
+        Initialize the pool
+
+        Args:
+            max_per_host: Idle connections kept per host
+            idle_timeout: Seconds an idle connection is kept
+            timeout: Socket timeout in seconds for new connections
+        """
+        self.max_per_host = max_per_host
+        self.idle_timeout = idle_timeout
+        self.timeout = timeout
+        self._idle = {}
+        self._lock = threading.Lock()
+        # Counters for diagnostics and tests
+        self.connections_opened = 0
+        self.connections_reused = 0
+
+    def request(self, method, url, headers=None, body=None):
+        """
+        Make a request over a pooled connection
+
+        Args:
+            method: HTTP method
+            url: Absolute http or https URL
+            headers: Optional request headers
+            body: Optional request body
+
+        Returns:
+            A PooledResponse
+
+        Raises:
+            ValueError: If the URL isn't http or https
+            OSError: If the request fails
+        """
+        key, path = _split_url(url)
+        headers = headers or {}
+
+        conn, reused = self._acquire(key)
+        try:
+            response = self._send(conn, method, path, headers, body)
+        except STALE_CONNECTION_ERRORS as e:
+            conn.close()
+            if not reused:
+                raise
+            logger.debug(f"Kept-alive connection to {key[1]} was closed ({e}), reconnecting")
+            conn = self._connect(key)
+            try:
+                response = self._send(conn, method, path, headers, body)
+            except Exception:
+                conn.close()
+                raise
+        except Exception:
+            conn.close()
+            raise
+
+        content = response.read()
+        pooled = PooledResponse(response.status, response.headers, content)
+        if response.will_close:
+            conn.close()
+        else:
+            self._release(key, conn)
+        return pooled
+
+    def close_all(self):
+        """Close every idle connection"""
+        with self._lock:
+            idle, self._idle = self._idle, {}
+        for connections in idle.values():
+            for conn, _ in connections:
+                conn.close()
+
+    def idle_count(self):
+        """Get the number of idle connections in the pool"""
+        with self._lock:
+            return sum(len(connections) for connections in self._idle.values())
+
+    def _acquire(self, key):
+        """
+        Take a healthy idle connection for a host or open a new one
+
+        Args:
+            key: (scheme, host, port)
+
+        Returns:
+            Tuple of (connection, True if it was reused)
+        """
+        now = time.monotonic()
+        while True:
+            with self._lock:
+                connections = self._idle.get(key)
+                if not connections:
+                    break
+                conn, last_used = connections.pop()
+            if now - last_used <= self.idle_timeout and _is_alive(conn):
+                self.connections_reused += 1
+                return conn, True
+            conn.close()
+        return self._connect(key), False
+
+    def _connect(self, key):
+        """Open a new connection"""
+        scheme, host, port = key
+        if scheme == "https":
+            conn = http.client.HTTPSConnection(host, port, timeout=self.timeout)
+        else:
+            conn = http.client.HTTPConnection(host, port, timeout=self.timeout)
+        self.connections_opened += 1
+        return conn
+
+    def _release(self, key, conn):
+        """Return a connection to the pool, or close it if the pool is full"""
+        with self._lock:
+            connections = self._idle.setdefault(key, [])
+            if len(connections) < self.max_per_host:
+                connections.append((conn, time.monotonic()))
+                return
+        conn.close()
+
+    @staticmethod
+    def _send(conn, method, path, headers, body):
+        """Send a request and read the status line and headers"""
+        conn.request(method, path, body=body, headers=headers)
+        return conn.getresponse()
+
+
+def _split_url(url):
+    """
+    Split a URL into its pool key and request path
+
+    Args:
+        url: Absolute http or https URL
+
+    Returns:
+        Tuple of ((scheme, host, port), path)
+    """
+    scheme, sep, rest = url.partition("://")
+    scheme = scheme.lower()
+    if not sep or scheme not in ("http", "https"):
+        raise ValueError(f"Unsupported URL: {url}")
+    netloc, slash, path = rest.partition("/")
+    host, colon, port = netloc.partition(":")
+    if colon:
+        port = int(port)
+    else:
+        port = 443 if scheme == "https" else 80
+    return (scheme, host, port), slash + path if slash else "/"
+
+
+def _is_alive(conn):
+    """
+    Check that an idle connection hasn't been closed by the server
+
+    An idle connection has nothing to read; if its socket is readable the
+    server has closed it (or sent something unexpected) and it can't be
+    reused.
+    """
+    sock = conn.sock
+    if sock is None:
+        return False
+    try:
+        readable, _, _ = select.select([sock], [], [], 0)
+    except (OSError, ValueError):
+        return False
+    return not readable
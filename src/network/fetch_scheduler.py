@@ -0,0 +1,134 @@
+"""
+Scheduler that runs network fetches with bounded concurrency.
+Copyright 2024 3DUPFitters LLC
+"""
+import asyncio
+
+from src.utils.error_handler import ErrorHandler
+
+# Initialize logger
+logger = ErrorHandler("error_log")
+
+# Result of a job that was cancelled before it started
+CANCELLED = object()
+
+# Seconds a worker waits when every pending job's host is at its limit
+HOST_WAIT_INTERVAL = 0.05
+
+
+class FetchJob:
+    """A fetch waiting to run"""
+
+    def __init__(self, host, fetch, priority, order):
+        """
+        Initialize a job
+
+        Args:
+            host: Host the fetch connects to
+            fetch: Callable returning the awaitable that does the fetch
+            priority: Lower numbers run first
+            order: Position the job was added at
+        """
+        self.host = host
+        self.fetch = fetch
+        self.priority = priority
+        self.order = order
+
+
+class FetchScheduler:
+    """
+    Runs fetch jobs through a fixed number of workers
+
+    At most max_concurrent fetches are in flight, and at most per_host of
+    them to the same host, so a multi-park refresh never opens more
+    sockets than the pool can hold. Jobs start in priority order, then
+    in the order they were added. cancel() stops jobs that haven't
+    started; fetches already in flight finish normally. The scheduler
+    only uses create_task, gather and sleep, so it runs on CircuitPython.
+    """
+
+    def __init__(self, max_concurrent=2, per_host=2):
+        """
+        Initialize the scheduler
+
+        Args:
+            max_concurrent: Maximum number of fetches in flight
+            per_host: Maximum number of fetches in flight to one host
+        """
+        self.max_concurrent = max(1, max_concurrent)
+        self.per_host = max(1, per_host)
+        self.cancelled = False
+        self._jobs = []
+        self._pending = []
+        self._active = {}
+        self._results = []
+
+    def add(self, host, fetch, priority=1):
+        """
+        Add a job
+
+        Args:
+            host: Host the fetch connects to
+            fetch: Callable taking no arguments that returns an awaitable
+            priority: Lower numbers run first
+
+        Returns:
+            Index of the job's entry in the results of run()
+        """
+        job = FetchJob(host, fetch, priority, len(self._jobs))
+        self._jobs.append(job)
+        return job.order
+
+    def cancel(self):
+        """Stop starting new jobs; safe to call from another thread"""
+        self.cancelled = True
+
+    async def run(self):
+        """
+        Run all jobs
+
+        Returns:
+            List of results in the order the jobs were added. A job that
+            raised has its exception as the result, and one that never
+            started has CANCELLED.
+        """
+        self._pending = sorted(self._jobs, key=lambda job: (job.priority, job.order))
+        self._active = {}
+        self._results = [CANCELLED] * len(self._jobs)
+
+        workers = []
+        for _ in range(min(self.max_concurrent, len(self._pending))):
+            workers.append(asyncio.create_task(self._worker()))
+        if workers:
+            await asyncio.gather(*workers)
+        return self._results
+
+    async def _worker(self):
+        """Run jobs until none are left"""
+        while self._pending and not self.cancelled:
+            job = self._next_job()
+            if job is None:
+                # Every pending job's host is busy
+                await asyncio.sleep(HOST_WAIT_INTERVAL)
+                continue
+
+            self._active[job.host] = self._active.get(job.host, 0) + 1
+            try:
+                self._results[job.order] = await job.fetch()
+            except Exception as e:
+                logger.error(e, f"Fetch from {job.host} failed")
+                self._results[job.order] = e
+            finally:
+                self._active[job.host] -= 1
+
+    def _next_job(self):
+        """
+        Take the first pending job whose host has room
+
+        Returns:
+            The job, or None if every pending job has to wait
+        """
+        for i, job in enumerate(self._pending):
+            if self._active.get(job.host, 0) < self.per_host:
+                return self._pending.pop(i)
+        return None
@@ -9,10 +9,13 @@ from src.utils.error_handler import ErrorHandler
 # Initialize logger
 logger = ErrorHandler("error_log")
 
+# Status returned for a conditional GET whose resource hasn't changed
+HTTP_NOT_MODIFIED = 304
+
 class BaseResponse:
     """Base class for all response types with common functionality"""
     
-    def __init__(self, status_code=200, text="", content=None):
+    def __init__(self, status_code=200, text="", content=None, headers=None):
         """
         Initialize a response
         
@@ -20,10 +23,12 @@ class BaseResponse:
             status_code: The HTTP status code
             text: The response body as text
             content: The response body as bytes (optional)
+            headers: The response headers (optional)
         """
         self.status_code = status_code
         self.text = text
         self.content = content if content is not None else text.encode('utf-8')
+        self.headers = headers if headers is not None else {}
         self._json_cache = None
         self._read_position = 0
         
@@ -94,7 +99,8 @@ class UrllibResponse(BaseResponse):
             text = ""  # Binary content, no text representation
         
         # Initialize base class with the extracted data
-        super().__init__(urllib_response.status, text, content)
+        super().__init__(urllib_response.status, text, content,
+                         headers=dict(urllib_response.headers.items()))
 
 
 class MockResponse(BaseResponse):
@@ -110,16 +116,21 @@ class HttpClient:
     which may be adafruit_requests, urllib, or another library.
     """
     
-    def __init__(self, session=None):
+    def __init__(self, session=None, keep_alive=False):
         """
         Initialize the HTTP client
         
         Args:
             session: The underlying session to use for requests
+            keep_alive: Reuse connections for GETs made without adafruit_requests
+                (adafruit_requests sessions already keep their sockets open)
         """
         self.session = session
         self.use_live_data = True  # Flag to force live data in dev mode
         
+        # Cache validators (ETag, Last-Modified) from the last 200 response per URL
+        self._validators = {}
+        
         # Check if we're in dev mode
         try:
             from src.ui.display_factory import is_dev_mode
@@ -149,8 +160,16 @@ class HttpClient:
             # urllib might not be available in CircuitPython
             self.urllib = None
             self.URLError = None
+        
+        self.connection_pool = None
+        if keep_alive and not self.using_adafruit:
+            try:
+                from src.network.connection_pool import ConnectionPool
+                self.connection_pool = ConnectionPool()
+            except ImportError:
+                logger.debug("http.client not available, connections won't be reused")
             
-    async def get(self, url, headers=None, max_retries=3):
+    async def get(self, url, headers=None, max_retries=3, conditional=False):
         """
         Make a GET request with retries
 
@@ -158,6 +177,10 @@ class HttpClient:
             url: The URL to request
             headers: Optional headers to include
             max_retries: Maximum number of retry attempts
+            conditional: Send the validators remembered for this URL so an
+                unchanged resource comes back as HTTP_NOT_MODIFIED with no body.
+                Validators are only remembered from conditional requests, so a
+                plain GET elsewhere can't vouch for data its caller never kept
 
         Returns:
             A Response object (native adafruit_requests, UrllibResponse, or MockResponse)
@@ -166,6 +189,8 @@ class HttpClient:
             headers = {
                 "User-Agent": "Mozilla/5.0 (CircuitPython)"
             }
+        if conditional:
+            headers = self._add_validators(url, headers)
 
         retry_count = 0
         last_error = None
@@ -264,6 +289,8 @@ class HttpClient:
                         try:
                             # Return the native adafruit_requests response directly
                             resp = self.session.get(url, headers=headers)
+                            if conditional:
+                                self._remember_validators(url, resp)
                             return resp
                             
                         except out_of_retries_exception as retry_error:
@@ -296,6 +323,19 @@ class HttpClient:
                         logger.error(adafruit_error, f"Error in Adafruit request outer block (attempt {retry_count+1})")
                         last_error = adafruit_error
                         retry_count += 1
+                elif self.connection_pool is not None:
+                    # Standard library over kept-alive connections
+                    try:
+                        wrapped = UrllibResponse(self.connection_pool.request("GET", url, headers))
+                        if wrapped.status_code >= 400:
+                            raise OSError(f"HTTP error {wrapped.status_code}")
+                        if conditional:
+                            self._remember_validators(url, wrapped)
+                        return wrapped
+                    except Exception as pool_error:
+                        logger.error(pool_error, f"Error in pooled request (attempt {retry_count+1})")
+                        last_error = pool_error
+                        retry_count += 1
                 else:
                     # For standard Python urllib - wrap response
                     try:
@@ -304,8 +344,14 @@ class HttpClient:
                         for key, value in headers.items():
                             request.add_header(key, value)
                         with self.urllib.urlopen(request) as response:
-                            return UrllibResponse(response)
+                            wrapped = UrllibResponse(response)
+                            if conditional:
+                                self._remember_validators(url, wrapped)
+                            return wrapped
                     except self.URLError as url_error:
+                        # urllib reports 304 as an HTTPError; it isn't a failure
+                        if getattr(url_error, 'code', None) == HTTP_NOT_MODIFIED:
+                            return MockResponse(status_code=HTTP_NOT_MODIFIED, text="")
                         logger.error(url_error, f"URLError (attempt {retry_count+1})")
                         last_error = url_error
                         retry_count += 1
@@ -375,6 +421,65 @@ class HttpClient:
             logger.error(e, f"Error making POST request to {url}")
             return MockResponse(status_code=500, text=str(e))
     
+    def _add_validators(self, url, headers):
+        """
+        Add conditional request headers for a URL
+        
+        Args:
+            url: The URL being requested
+            headers: The request headers
+            
+        Returns:
+            A copy of headers with If-None-Match/If-Modified-Since added, or
+            headers unchanged if nothing is remembered for the URL
+        """
+        validators = self._validators.get(url)
+        if not validators:
+            return headers
+            
+        etag, last_modified = validators
+        headers = dict(headers)
+        if etag:
+            headers["If-None-Match"] = etag
+        if last_modified:
+            headers["If-Modified-Since"] = last_modified
+        return headers
+    
+    def _remember_validators(self, url, response):
+        """
+        Store the ETag and Last-Modified of a successful response
+        
+        Args:
+            url: The URL that was requested
+            response: The response received
+        """
+        if getattr(response, 'status_code', None) != 200:
+            return
+            
+        etag = _get_header(response, "ETag")
+        last_modified = _get_header(response, "Last-Modified")
+        if etag or last_modified:
+            self._validators[url] = (etag, last_modified)
+        else:
+            self._validators.pop(url, None)
+    
+    def forget_validators(self, url):
+        """
+        Drop the validators for a URL so the next GET fetches the full body
+        
+        Call this when a response body couldn't be used, so the server
+        isn't asked to confirm data that was never stored.
+        
+        Args:
+            url: The URL to forget
+        """
+        self._validators.pop(url, None)
+    
+    def close(self):
+        """Close any connections kept open for reuse"""
+        if self.connection_pool is not None:
+            self.connection_pool.close_all()
+    
     def set_use_live_data(self, use_live_data):
         """
         Set whether to use live data or mock data in development mode
@@ -455,4 +560,32 @@ class HttpClient:
         # All retries failed
         error_msg = str(last_error) if last_error else "Unknown error"
         logger.error(None, f"All {max_retries} GET attempts to {url} failed: {error_msg}")
-        return MockResponse(status_code=500, text=f"Error: {error_msg}")
\ No newline at end of file
+        return MockResponse(status_code=500, text=f"Error: {error_msg}")
+
+
+def _get_header(response, name):
+    """
+    Look up a response header case-insensitively
+    
+    adafruit_requests keeps header names as sent by the server, so a plain
+    dictionary lookup can miss them.
+    
+    Args:
+        response: The response object
+        name: The header name
+        
+    Returns:
+        The header value, or None if it isn't present
+    """
+    headers = getattr(response, 'headers', None)
+    if not headers:
+        return None
+        
+    name = name.lower()
+    try:
+        for key, value in headers.items():
+            if key.lower() == name:
+                return value
+    except (AttributeError, TypeError):
+        pass
+    return None
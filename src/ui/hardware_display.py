@@ -13,6 +13,7 @@ from adafruit_display_text.label import Label
 
 from src.ui.display_interface import DisplayInterface
 from src.ui.reveal_animation import show_reveal_splash
+from src.ui.text_scroller import TextScroller
 from src.utils.color_utils import ColorUtils
 from src.utils.error_handler import ErrorHandler
 
@@ -39,6 +40,7 @@ class MatrixDisplay(DisplayInterface):
         # For scrolling
         self.scroll_position = 0
         self.scroll_delay = 0.04
+        self._scroller = None
         
         # Display groups
         self.main_group = None
@@ -461,6 +463,8 @@ class MatrixDisplay(DisplayInterface):
         self._hide_all_groups()
         self.scrolling_label.text = message
         self.scrolling_group.hidden = False
+        # Start over even if the last message had the same text
+        self._scroller = None
         await asyncio.sleep(.5)
         
         # Scroll until complete
@@ -474,18 +478,18 @@ class MatrixDisplay(DisplayInterface):
         """
         Scroll a line horizontally
         
+        The line moves at 1 / scroll_delay pixels per second measured on
+        the clock, so slow frames don't stretch the scroll.
+        
         Args:
             line: The line to scroll
             
         Returns:
             True if still scrolling, False if done
         """
-        line.x = line.x - 1
-        line_width = line.bounding_box[2]
-        if line.x < -line_width:
-            line.x = self.hardware.display.width
-            return False
-        return True
+        display_width = self.hardware.display.width
+        self._scroller = TextScroller.step(self._scroller, line, display_width, 1 / self.scroll_delay)
+        return self._scroller is not None
         
     def _center_text(self, text_label):
         """
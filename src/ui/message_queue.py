@@ -7,6 +7,7 @@ import asyncio
 from src.utils.error_handler import ErrorHandler
 from src.models.vacation import Vacation
 from src.models.theme_park_list import ThemeParkList
+from src.models.ride_table import RideTable
 
 # Initialize logger
 logger = ErrorHandler("error_log")
@@ -14,6 +15,11 @@ logger = ErrorHandler("error_log")
 # Constants
 REQUIRED_MESSAGE = "queue-times.com"
 
+# Bits of a combined sort entry that hold the ride's row; the rest
+# hold the park's position
+ROW_BITS = 16
+ROW_MASK = (1 << ROW_BITS) - 1
+
 
 class MessageQueue:
     """Manages the queue of messages to display"""
@@ -37,6 +43,9 @@ class MessageQueue:
         self.func_queue = []
         self.param_queue = []
         self.delay_queue = []
+        # Identifies each entry so a rebuild can match it to the new queue
+        self.key_queue = []
+        self._staged = None
         self.index = 0
         self.has_completed_cycle = False
         # Force any currently running display operation to stop
@@ -51,9 +60,7 @@ class MessageQueue:
             the_message: The message to scroll
             delay: The delay after showing the message
         """
-        self.func_queue.append(self.display.show_scroll_message)
-        self.param_queue.append(the_message)
-        self.delay_queue.append(delay)
+        self._append(self.display.show_scroll_message, the_message, delay)
 
     async def add_splash(self, duration=10, reveal_style=False):
         """
@@ -64,9 +71,8 @@ class MessageQueue:
             reveal_style: If True, use reveal animation instead of static display
         """
         logger.debug(f"Adding splash message to queue with duration={duration}, reveal_style={reveal_style}")
-        self.func_queue.append(self.display.show_splash)
-        self.param_queue.append((duration, reveal_style))
-        self.delay_queue.append(0)  # No additional delay since duration is handled in show_splash
+        # No additional delay since duration is handled in show_splash
+        self._append(self.display.show_splash, (duration, reveal_style), 0)
 
     async def add_vacation(self, vac):
         """
@@ -94,10 +100,8 @@ class MessageQueue:
         Args:
             park_name: The name of the park
         """
-        self.func_queue.append(self.display.show_scroll_message)
         required_message = f"Wait times for {park_name} provided by {REQUIRED_MESSAGE}"
-        self.param_queue.append(required_message)
-        self.delay_queue.append(self.delay)
+        self._append(self.display.show_scroll_message, required_message, self.delay)
 
     async def add_rides(self, park_list):
         """
@@ -119,9 +123,7 @@ class MessageQueue:
                 logger.debug(f"MessageQueue.add_rides() called for single park: {park.name}:{park.id}")
         
         if not parks_to_display:
-            self.func_queue.append(self.display.show_scroll_message)
-            self.delay_queue.append(self.delay)
-            self.param_queue.append("No parks selected")
+            self._append(self.display.show_scroll_message, "No parks selected", self.delay)
             return
 
         # Get sort settings
@@ -136,62 +138,33 @@ class MessageQueue:
             # Process each park separately, maintaining the order they were selected
             for park in parks_to_display:
                 if park.is_open is False:
-                    self.func_queue.append(self.display.show_scroll_message)
-                    self.delay_queue.append(self.delay)
-                    self.param_queue.append(park.name + " is closed")
+                    self._append(self.display.show_scroll_message, park.name + " is closed", self.delay)
                 else:
                     await self._add_park_rides_sorted(park, park_list.skip_meet, park_list.skip_closed, sort_mode)
         else:
-            # Combine all rides from all parks and sort together
-            all_rides = []
+            # Combine all rides from all parks and sort together. Each
+            # entry packs the park's position and the ride's row into one int
+            tables = []
+            entries = []
             for park in parks_to_display:
                 if park.is_open:
-                    # Collect rides with their park info
-                    for ride in park.rides:
-                        # Apply filters
-                        if "Meet" in ride.name and park_list.skip_meet:
-                            continue
-                        if ride.is_open() is False and park_list.skip_closed:
-                            continue
-                        all_rides.append((ride, park))
+                    table = self._ride_table(park)
+                    base = len(tables) << ROW_BITS
+                    for row in table.select(park_list.skip_meet, park_list.skip_closed):
+                        entries.append(base | row)
+                    tables.append(table)
             
             # Sort the combined list
-            sorted_rides = self._sort_rides(all_rides, sort_mode)
+            keys = [table.sort_key(sort_mode) for table in tables]
+            entries.sort(key=lambda entry: keys[entry >> ROW_BITS](entry & ROW_MASK),
+                         reverse=RideTable.sort_descending(sort_mode))
             
             # Add sorted rides to queue
-            for ride, park in sorted_rides:
-                await self._add_single_ride(ride, park)
+            for entry in entries:
+                await self._add_ride_row(tables[entry >> ROW_BITS], entry & ROW_MASK)
             
         self.regenerate_flag = False
     
-    def _sort_rides(self, rides_with_parks, sort_mode):
-        """
-        Sort rides based on the specified sort mode
-        
-        Args:
-            rides_with_parks: List of (ride, park) tuples
-            sort_mode: "alphabetical", "max_wait", or "min_wait"
-            
-        Returns:
-            Sorted list of (ride, park) tuples
-        """
-        if sort_mode == "alphabetical":
-            return sorted(rides_with_parks, key=lambda x: x[0].name.lower())
-        elif sort_mode == "max_wait":
-            # Sort by wait time descending (longest first)
-            # Only truly closed rides (open_flag=False) are treated as 0
-            return sorted(rides_with_parks, 
-                         key=lambda x: x[0].wait_time if x[0].open_flag else 0, 
-                         reverse=True)
-        elif sort_mode == "min_wait":
-            # Sort by wait time ascending (shortest first)
-            # Only truly closed rides (open_flag=False) are treated as 0
-            return sorted(rides_with_parks, 
-                         key=lambda x: x[0].wait_time if x[0].open_flag else 0)
-        else:
-            # Default to alphabetical if unknown sort mode
-            return sorted(rides_with_parks, key=lambda x: x[0].name.lower())
-    
     async def _add_park_rides_sorted(self, park, skip_meet, skip_closed, sort_mode):
         """
         Add rides from a single park in sorted order
@@ -203,49 +176,162 @@ class MessageQueue:
             sort_mode: The sort mode to use
         """
         # Start with the park name
-        self.func_queue.append(self.display.show_scroll_message)
-        self.delay_queue.append(self.delay)
-        self.param_queue.append(park.name + " wait times...")
+        self._append(self.display.show_scroll_message, park.name + " wait times...", self.delay)
         
-        # Collect and filter rides
-        rides_to_show = []
-        for ride in park.rides:
-            if "Meet" in ride.name and skip_meet:
-                continue
-            if ride.is_open() is False and skip_closed:
-                continue
-            rides_to_show.append((ride, park))
-        
-        # Sort the rides
-        sorted_rides = self._sort_rides(rides_to_show, sort_mode)
+        # Filter and sort the park's rides by row
+        table = self._ride_table(park)
+        rows = table.select(skip_meet, skip_closed)
+        rows.sort(key=table.sort_key(sort_mode), reverse=RideTable.sort_descending(sort_mode))
         
         # Add sorted rides to queue
-        for ride, _ in sorted_rides:
-            await self._add_single_ride(ride, park)
+        for row in rows:
+            await self._add_ride_row(table, row)
     
-    async def _add_single_ride(self, ride, park):
+    @staticmethod
+    def _ride_table(park):
+        """
+        Get a park's rides as a RideTable
+        
+        Args:
+            park: The theme park
+            
+        Returns:
+            The park's RideTable, or one built from its list of ride objects
+        """
+        if isinstance(park.rides, RideTable):
+            return park.rides
+        return RideTable.from_rides(park.rides)
+    
+    async def _add_ride_row(self, table, row):
         """
         Add a single ride to the display queue
         
         Args:
-            ride: The ride to add
-            park: The park the ride belongs to (for context if needed)
+            table: The RideTable holding the ride
+            row: The ride's row in the table
         """
         await asyncio.sleep(0)
         
-        if ride.open_flag is True:
-            self.func_queue.append(self.display.show_ride_wait_time)
-            self.param_queue.append(str(ride.wait_time))
-            self.delay_queue.append(0)
+        # Keyed by the ride, so a refresh patches the wait time in place
+        ride = (table.ids[row], table.names[row])
+        if table.open_flag(row):
+            self._append(self.display.show_ride_wait_time, str(table.wait_times[row]), 0,
+                         ("status",) + ride)
         else:
-            self.func_queue.append(self.display.show_ride_closed)
-            self.param_queue.append("Closed")
-            self.delay_queue.append(0)
+            self._append(self.display.show_ride_closed, "Closed", 0, ("status",) + ride)
 
-        self.func_queue.append(self.display.show_ride_name)
-        self.param_queue.append(ride.name)
         # Use minimal delay for ride names to keep display responsive
-        self.delay_queue.append(0.5)
+        self._append(self.display.show_ride_name, table.names[row], 0.5, ("name",) + ride)
+
+    def _append(self, func, param, delay, key=None):
+        """
+        Add an entry to the queue, or to the staged queue during a rebuild
+        
+        Args:
+            func: The display function to call
+            param: The parameter (or tuple of parameters) to call it with
+            delay: The delay after showing the entry
+            key: What the entry shows, for matching it across rebuilds;
+                defaults to (func, param)
+        """
+        if key is None:
+            key = (func, param)
+        funcs, params, delays, keys = self._staged or (
+            self.func_queue, self.param_queue, self.delay_queue, self.key_queue)
+        funcs.append(func)
+        params.append(param)
+        delays.append(delay)
+        keys.append(key)
+
+    def begin_rebuild(self):
+        """
+        Start building a new queue while the current one keeps showing
+        
+        The add methods fill a staged queue until apply_rebuild() merges
+        it into the live one.
+        """
+        self._staged = ([], [], [], [])
+
+    def apply_rebuild(self):
+        """
+        Merge the staged queue into the live queue
+        
+        When the entries both queues share are in the same order, which
+        is the usual case after a refresh, the live lists are patched:
+        shared entries get their new parameters in place and only the
+        entries for rides that appeared or dropped out are inserted or
+        removed. Otherwise (e.g. a wait time sort reordered rides) the
+        live lists' contents are replaced. Either way the cursor stays
+        on the entry that was due next, or the first one after it that
+        survived, instead of going back to the splash screen.
+        """
+        if self._staged is None:
+            return
+        funcs, params, delays, keys = self._staged
+        self._staged = None
+
+        # The entry that would have been shown next
+        old_keys = self.key_queue
+        wanted = set(keys)
+        cursor_key = None
+        for i in range(self.index, len(old_keys)):
+            if old_keys[i] in wanted:
+                cursor_key = old_keys[i]
+                break
+
+        if self._can_patch(keys, wanted):
+            self._patch(funcs, params, delays, keys, wanted)
+        else:
+            self.func_queue[:] = funcs
+            self.param_queue[:] = params
+            self.delay_queue[:] = delays
+            self.key_queue[:] = keys
+
+        self.index = keys.index(cursor_key) if cursor_key is not None else 0
+        self.has_completed_cycle = False
+
+    def _can_patch(self, keys, wanted):
+        """
+        Check whether the live queue can be patched into the staged one
+        
+        Args:
+            keys: The staged queue's keys
+            wanted: The staged keys as a set
+            
+        Returns:
+            True if the keys are unique and the shared ones are in the same order
+        """
+        old_keys = self.key_queue
+        if len(old_keys) != len(self.func_queue) or not old_keys:
+            return False
+        existing = set(old_keys)
+        if len(existing) != len(old_keys) or len(wanted) != len(keys):
+            return False
+        shared_old = [key for key in old_keys if key in wanted]
+        shared_new = [key for key in keys if key in existing]
+        return shared_old == shared_new
+
+    def _patch(self, funcs, params, delays, keys, wanted):
+        """Update the live lists in place to match the staged queue"""
+        live = (self.func_queue, self.param_queue, self.delay_queue, self.key_queue)
+        i = 0
+        for j in range(len(keys)):
+            # Drop entries that aren't in the new queue
+            while i < len(self.key_queue) and self.key_queue[i] not in wanted:
+                for queue in live:
+                    del queue[i]
+            if i < len(self.key_queue) and self.key_queue[i] == keys[j]:
+                self.func_queue[i] = funcs[j]
+                self.param_queue[i] = params[j]
+                self.delay_queue[i] = delays[j]
+            else:
+                self.func_queue.insert(i, funcs[j])
+                self.param_queue.insert(i, params[j])
+                self.delay_queue.insert(i, delays[j])
+                self.key_queue.insert(i, keys[j])
+            i += 1
+        for queue in live:
+            del queue[i:]
 
     async def show(self):
         """Show the next message in the queue"""
@@ -0,0 +1,111 @@
+"""
+Time-based horizontal scrolling for text labels.
+Copyright 2024 3DUPFitters LLC
+"""
+import time
+
+NS_PER_SECOND = 1000000000
+
+
+class TextScroller:
+    """Scrolls a rendered label across the display at a fixed speed
+    
+    The label is rasterized once when its text is set; displayio then
+    shows a window into that bitmap at the label's x position, so each
+    frame only moves the window. Position is driven by elapsed time on
+    a fixed timestep: speeds can be fractional pixels per second, and a
+    slow frame is caught up on the next call instead of stretching the
+    scroll. Time is kept in integer nanoseconds, since CircuitPython's
+    float time.monotonic() loses sub-frame resolution after a day of
+    uptime. Works on CircuitPython and in the simulator.
+    """
+    
+    def __init__(self, label, display_width, speed=25.0, frame_rate=60, max_catchup=0.25):
+        """
+        Initialize the scroller
+        
+        Args:
+            label: The label to scroll; it starts at its current x
+            display_width: Width of the display in pixels
+            speed: Scroll speed in pixels per second
+            frame_rate: Fixed timestep rate the position advances at
+            max_catchup: Longest stall in seconds to catch up on
+        """
+        self.label = label
+        self.text = label.text
+        self.display_width = display_width
+        self.speed = speed
+        self.frame_rate = frame_rate
+        self.max_catchup = max_catchup
+        self._max_catchup_ns = int(max_catchup * NS_PER_SECOND)
+        
+        self.start_x = label.x
+        # Text is rasterized once, so its width is fixed for the scroll
+        self.text_width = label.bounding_box[2]
+        self.position = 0.0
+        self._steps = 0
+        # Elapsed nanoseconds times frame_rate; a step is NS_PER_SECOND
+        self._accumulator = 0
+        self._last_ns = None
+        
+    @classmethod
+    def step(cls, scroller, label, display_width, speed, now_ns=None):
+        """
+        Advance a display's current scroll by one frame
+        
+        A new scroller is started when there is none yet, or when the
+        label or its text changed since the last call.
+        
+        Args:
+            scroller: The scroller returned by the previous call, or None
+            label: The label to scroll
+            display_width: Width of the display in pixels
+            speed: Scroll speed in pixels per second
+            now_ns: Optional time.monotonic_ns() value
+        
+        Returns:
+            The scroller to pass to the next call, or None once the text
+            has left the display
+        """
+        if scroller is None or scroller.label is not label or scroller.text != label.text:
+            scroller = cls(label, display_width, speed=speed)
+        if not scroller.advance(now_ns):
+            return None
+        return scroller
+        
+    def advance(self, now_ns=None):
+        """
+        Move the label to where it should be at the current time
+        
+        Args:
+            now_ns: Optional time.monotonic_ns() value
+        
+        Returns:
+            True if still scrolling, False once the text has left the display
+        """
+        if now_ns is None:
+            now_ns = time.monotonic_ns()
+        if self._last_ns is None:
+            self._last_ns = now_ns
+        
+        elapsed = min(max(0, now_ns - self._last_ns), self._max_catchup_ns)
+        self._last_ns = now_ns
+        self._accumulator += elapsed * self.frame_rate
+        
+        # Consume whole steps; the remainder carries over. Counting
+        # steps keeps the position free of accumulated rounding error
+        steps = int(self._accumulator // NS_PER_SECOND)
+        if steps:
+            self._accumulator -= steps * NS_PER_SECOND
+            self._steps += steps
+            self.position = self.speed * self._steps / self.frame_rate
+        
+        x = self.start_x - int(self.position)
+        if x < -self.text_width:
+            self.label.x = self.display_width
+            return False
+        
+        # Only touch the label when it lands on a new pixel
+        if x != self.label.x:
+            self.label.x = x
+        return True
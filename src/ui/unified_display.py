@@ -52,6 +52,7 @@ else:
 
 from src.ui.display_interface import DisplayInterface
 from src.ui.reveal_animation import show_reveal_splash
+from src.ui.text_scroller import TextScroller
 from src.utils.color_utils import ColorUtils
 from src.utils.error_handler import ErrorHandler
 
@@ -104,6 +105,7 @@ class UnifiedDisplay(DisplayInterface):
         # For scrolling
         self.scroll_position = 0
         self.scroll_delay = 0.04
+        self._scroller = None
         
         # Display groups
         self.main_group = None
@@ -421,10 +423,13 @@ class UnifiedDisplay(DisplayInterface):
             # Update the display
             self.display.refresh(minimum_frames_per_second=0)
             
-            # Update the pygame display
-            if hasattr(self.matrix, 'render'):
-                self.matrix.render()
-            pygame.display.flip()
+            # Push only the changed parts of the matrix to the window
+            if hasattr(self.matrix, 'present'):
+                dirty_rects = self.matrix.present(pygame.display.get_surface())
+                if dirty_rects:
+                    pygame.display.update(dirty_rects)
+            else:
+                pygame.display.flip()
             
         return True
     
@@ -434,6 +439,10 @@ class UnifiedDisplay(DisplayInterface):
             # CircuitPython doesn't need this
             return
             
+        if getattr(self.device, 'headless', False):
+            await self._run_headless()
+            return
+            
         # Initialize pygame if not already done
         import pygame
         if not pygame.get_init():
@@ -447,6 +456,10 @@ class UnifiedDisplay(DisplayInterface):
         clock = pygame.time.Clock()
         running = True
         
+        # The new window needs every LED drawn once
+        if hasattr(self.matrix, 'invalidate'):
+            self.matrix.invalidate()
+        
         while running:
             # Handle events
             for event in pygame.event.get():
@@ -468,14 +481,12 @@ class UnifiedDisplay(DisplayInterface):
             if self.display and self.display.root_group:
                 self.display.refresh(minimum_frames_per_second=0)
             
-            # Render to screen
-            if hasattr(self.matrix, 'render'):
-                self.matrix.render()
-                # Get the rendered surface and blit to screen
-                if hasattr(self.matrix, 'surface'):
-                    screen.blit(self.matrix.surface, (0, 0))
+            # Render to screen, pushing only the changed rectangles
+            if hasattr(self.matrix, 'present'):
+                dirty_rects = self.matrix.present(screen)
+                if dirty_rects:
+                    pygame.display.update(dirty_rects)
             
-            pygame.display.flip()
             clock.tick(60)  # 60 FPS
             
             # Yield control to allow other async tasks to run
@@ -484,6 +495,17 @@ class UnifiedDisplay(DisplayInterface):
         # Clean up
         pygame.quit()
     
+    async def _run_headless(self):
+        """Refresh at 60 FPS without a window.
+        
+        Under a VirtualClock event loop each sleep is an exact frame
+        step, so the loop runs as fast as the CPU allows.
+        """
+        while True:
+            if self.display and self.display.root_group:
+                self.display.refresh(minimum_frames_per_second=0)
+            await asyncio.sleep(1 / 60)
+    
     def show_image(self, image, x=0, y=0):
         """
         Display an image on the matrix
@@ -734,6 +756,8 @@ class UnifiedDisplay(DisplayInterface):
         self._hide_all_groups()
         self.scrolling_label.text = message
         self.scrolling_group.hidden = False
+        # Start over even if the last message had the same text
+        self._scroller = None
         await asyncio.sleep(.5)
         
         # Scroll until complete
@@ -747,19 +771,18 @@ class UnifiedDisplay(DisplayInterface):
         """
         Scroll a line horizontally
         
+        The line moves at 1 / scroll_delay pixels per second measured on
+        the clock, so slow frames don't stretch the scroll.
+        
         Args:
             line: The line to scroll
             
         Returns:
             True if still scrolling, False if done
         """
-        line.x = line.x - 1
-        line_width = line.bounding_box[2]
         display_width = self.hardware.display.width if IS_CIRCUITPYTHON else self.display.width
-        if line.x < -line_width:
-            line.x = display_width
-            return False
-        return True
+        self._scroller = TextScroller.step(self._scroller, line, display_width, 1 / self.scroll_delay)
+        return self._scroller is not None
         
     def _center_text(self, text_label):
         """
@@ -0,0 +1,171 @@
+"""
+Small persistent key/value cache for the last good API responses.
+Copyright 2024 3DUPFitters LLC
+"""
+import json
+import os
+import time
+
+from src.utils.error_handler import ErrorHandler
+
+# Initialize logger
+logger = ErrorHandler("error_log")
+
+# Suffix of the file an entry is written to before it replaces the old one
+TEMP_SUFFIX = ".tmp"
+
+
+class FlashCache:
+    """
+    Stores compact JSON entries on the device filesystem
+
+    Each key is one file holding the data and the time it was saved.
+    Entries are written to a temporary file first and swapped in, so a
+    power loss mid-write leaves the previous entry readable. Flash has
+    limited write cycles, so a key is rewritten at most once every
+    min_interval seconds. When the filesystem is read-only (the USB
+    drive is writable from the computer side) saving quietly stops and
+    loading keeps working.
+    """
+
+    def __init__(self, directory="cache", min_interval=900, max_bytes=32768):
+        """
+        Initialize the cache
+
+        Args:
+            directory: Directory the entries are stored in
+            min_interval: Minimum seconds between writes of the same key
+            max_bytes: Largest entry that will be written
+        """
+        self.directory = directory
+        self.min_interval = min_interval
+        self.max_bytes = max_bytes
+        self.writable = True
+        self._last_write = {}
+
+    def _path(self, key):
+        """Get the file name for a key"""
+        return self.directory + "/" + key + ".json"
+
+    def save(self, key, data, force=False):
+        """
+        Save data under a key
+
+        Args:
+            key: Entry name; letters, digits and underscores
+            data: JSON-serializable data
+            force: Write even if the key was saved within min_interval
+
+        Returns:
+            True if the entry was written, False otherwise
+        """
+        if not self.writable:
+            return False
+
+        now = time.monotonic()
+        last = self._last_write.get(key)
+        if not force and last is not None and now - last < self.min_interval:
+            return False
+
+        try:
+            payload = json.dumps({"saved": time.time(), "data": data})
+        except (TypeError, ValueError) as e:
+            logger.error(e, f"Cache entry {key} is not serializable")
+            return False
+        if len(payload) > self.max_bytes:
+            logger.error(None, f"Cache entry {key} is too large ({len(payload)} bytes)")
+            return False
+
+        path = self._path(key)
+        temp_path = path + TEMP_SUFFIX
+        try:
+            self._make_directory()
+            with open(temp_path, "w") as f:
+                f.write(payload)
+            # FAT can't rename over an existing file
+            _remove(path)
+            os.rename(temp_path, path)
+        except OSError as e:
+            # Read-only filesystem (errno 30) or out of space
+            logger.debug(f"Not caching {key}, filesystem not writable: {e}")
+            self.writable = False
+            _remove(temp_path)
+            return False
+
+        self._last_write[key] = now
+        return True
+
+    def load(self, key, max_age=None):
+        """
+        Load the data saved under a key
+
+        Args:
+            key: Entry name
+            max_age: Optional age in seconds past which the entry is ignored.
+                The age is only checked once the clock is later than the save
+                time, since the clock isn't set until NTP runs after boot.
+
+        Returns:
+            The saved data, or None if there is no usable entry
+        """
+        entry = self.load_entry(key)
+        if entry is None:
+            return None
+        saved, data = entry
+        if max_age is not None:
+            now = time.time()
+            if now >= saved and now - saved > max_age:
+                logger.debug(f"Cache entry {key} is {int(now - saved)}s old, ignoring it")
+                return None
+        return data
+
+    def load_entry(self, key):
+        """
+        Load an entry with its save time
+
+        Args:
+            key: Entry name
+
+        Returns:
+            Tuple of (saved time, data), or None if there is no readable entry
+        """
+        path = self._path(key)
+        # A missing entry with a temporary file means the swap was interrupted
+        for candidate in (path, path + TEMP_SUFFIX):
+            try:
+                with open(candidate, "r") as f:
+                    entry = json.load(f)
+                return entry["saved"], entry["data"]
+            except OSError:
+                continue
+            except (ValueError, KeyError, TypeError) as e:
+                logger.error(e, f"Discarding unreadable cache entry {candidate}")
+                continue
+        return None
+
+    def remove(self, key):
+        """
+        Delete the entry saved under a key
+
+        Args:
+            key: Entry name
+        """
+        path = self._path(key)
+        _remove(path)
+        _remove(path + TEMP_SUFFIX)
+        self._last_write.pop(key, None)
+
+    def _make_directory(self):
+        """Create the cache directory if it doesn't exist"""
+        try:
+            os.stat(self.directory)
+        except OSError:
+            os.mkdir(self.directory)
+
+
+def _remove(path):
+    """Delete a file, ignoring a missing file or read-only filesystem"""
+    try:
+        os.remove(path)
+    except OSError:
+        pass
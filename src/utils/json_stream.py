@@ -0,0 +1,349 @@
+"""
+Streaming JSON reader that extracts selected fields without building the document.
+Copyright 2024 3DUPFitters LLC
+"""
+
+# Byte values used by the scanner
+_QUOTE = 0x22
+_BACKSLASH = 0x5C
+_COLON = 0x3A
+_COMMA = 0x2C
+_OPEN_OBJECT = 0x7B
+_CLOSE_OBJECT = 0x7D
+_OPEN_ARRAY = 0x5B
+_CLOSE_ARRAY = 0x5D
+_WHITESPACE = b" \t\r\n"
+_NUMBER_CHARS = b"+-.eE0123456789"
+_ESCAPES = {
+    ord('"'): '"', ord('\\'): '\\', ord('/'): '/', ord('b'): '\b',
+    ord('f'): '\f', ord('n'): '\n', ord('r'): '\r', ord('t'): '\t',
+}
+# U+FFFD, decoded in place of an unpaired surrogate
+_REPLACEMENT = b"\xef\xbf\xbd"
+
+# Path step that stands for every item of an array
+ANY = "*"
+
+
+class JsonStream:
+    """
+    Pull parser over a JSON byte stream
+
+    The document is read in chunks and never materialized. collect()
+    walks it once: objects at the requested paths are reduced to the
+    requested scalar fields and handed to a callback, and everything
+    else (including unwanted strings) is skipped without being decoded.
+    Peak memory is one chunk plus the record being built.
+    """
+
+    def __init__(self, source, chunk_size=512):
+        """
+        Initialize the stream
+
+        Args:
+            source: bytes, an object with read(size) (a file or response),
+                or an iterable of byte chunks (e.g. response.iter_content())
+            chunk_size: Bytes to request per read
+        """
+        if isinstance(source, (bytes, bytearray, memoryview)):
+            self._chunks = iter((bytes(source),))
+        elif hasattr(source, 'read'):
+            self._chunks = _read_chunks(source, chunk_size)
+        else:
+            self._chunks = iter(source)
+        self._buf = b""
+        self._pos = 0
+        self._targets = {}
+        self._prefixes = set()
+
+    def collect(self, targets):
+        """
+        Parse the whole document, reporting the objects at given paths
+
+        A path is a tuple of object keys and ANY for array items, e.g.
+        ("lands", ANY, "rides", ANY) for every ride in every land.
+
+        Args:
+            targets: Dictionary mapping path to (fields, callback). For each
+                object at the path, callback receives a dictionary holding
+                the fields that were present with scalar values.
+
+        Raises:
+            ValueError: If the document isn't valid JSON
+        """
+        self._targets = targets
+        self._prefixes = set()
+        for path in targets:
+            for length in range(len(path) + 1):
+                self._prefixes.add(path[:length])
+
+        self._value(())
+        if self._peek() != -1:
+            raise ValueError("syntax error in JSON: trailing data")
+
+    def _value(self, path):
+        """Parse or skip the value at the current position"""
+        c = self._peek()
+        if c == _OPEN_OBJECT:
+            if path in self._targets:
+                self._record(path)
+            elif path in self._prefixes:
+                self._object(path)
+            else:
+                self._skip_container()
+        elif c == _OPEN_ARRAY:
+            if path in self._prefixes:
+                self._array(path)
+            else:
+                self._skip_container()
+        elif c == _QUOTE:
+            self._skip_string()
+        else:
+            self._scalar()
+
+    def _object(self, path):
+        """Walk an object on the way to a target"""
+        self._pos += 1
+        if self._peek() == _CLOSE_OBJECT:
+            self._pos += 1
+            return
+        while True:
+            key = self._key()
+            self._value(path + (key,))
+            if self._end_of(_CLOSE_OBJECT):
+                return
+
+    def _array(self, path):
+        """Walk an array on the way to a target"""
+        self._pos += 1
+        if self._peek() == _CLOSE_ARRAY:
+            self._pos += 1
+            return
+        child = path + (ANY,)
+        while True:
+            self._value(child)
+            if self._end_of(_CLOSE_ARRAY):
+                return
+
+    def _record(self, path):
+        """Reduce a target object to its wanted fields"""
+        fields, callback = self._targets[path]
+        record = {}
+        self._pos += 1
+        if self._peek() == _CLOSE_OBJECT:
+            self._pos += 1
+        else:
+            while True:
+                key = self._key()
+                c = self._peek()
+                if key in fields and c not in (_OPEN_OBJECT, _OPEN_ARRAY):
+                    record[key] = self._string() if c == _QUOTE else self._scalar()
+                else:
+                    self._value(path + (key,))
+                if self._end_of(_CLOSE_OBJECT):
+                    break
+        callback(record)
+
+    def _key(self):
+        """Read an object key and the colon after it"""
+        if self._peek() != _QUOTE:
+            raise ValueError("syntax error in JSON: expected key")
+        key = self._string()
+        if self._peek() != _COLON:
+            raise ValueError("syntax error in JSON: expected ':'")
+        self._pos += 1
+        return key
+
+    def _end_of(self, close):
+        """
+        Consume the separator after a member or item
+
+        Returns:
+            True if the container closed, False if another entry follows
+        """
+        c = self._peek()
+        self._pos += 1
+        if c == _COMMA:
+            return False
+        if c == close:
+            return True
+        raise ValueError("syntax error in JSON: expected ',' or closing bracket")
+
+    def _scalar(self):
+        """Read a number, true, false or null"""
+        c = self._peek()
+        if c == -1:
+            raise ValueError("syntax error in JSON: unexpected end of data")
+        if c in _NUMBER_CHARS:
+            token = self._token(_NUMBER_CHARS)
+            try:
+                if b"." in token or b"e" in token or b"E" in token:
+                    return float(token)
+                return int(token)
+            except ValueError:
+                raise ValueError("syntax error in JSON: bad number")
+
+        token = self._token(b"truefalsn")
+        if token == b"true":
+            return True
+        if token == b"false":
+            return False
+        if token == b"null":
+            return None
+        raise ValueError("syntax error in JSON: unexpected character")
+
+    def _token(self, allowed):
+        """Read a run of allowed bytes, which may span chunks"""
+        parts = []
+        while True:
+            buf = self._buf
+            start = pos = self._pos
+            end = len(buf)
+            while pos < end and buf[pos] in allowed:
+                pos += 1
+            parts.append(buf[start:pos])
+            self._pos = pos
+            if pos < end or not self._fill():
+                return b"".join(parts)
+
+    def _string(self):
+        """Read and decode a string"""
+        self._pos += 1
+        out = bytearray()
+        # A \u escape for the first half of a UTF-16 surrogate pair waits
+        # here for the second half; anything else in between orphans it
+        high = 0
+        while True:
+            buf = self._buf
+            quote = buf.find(b'"', self._pos)
+            escape = buf.find(b'\\', self._pos)
+            if quote == -1 and escape == -1:
+                if high and self._pos < len(buf):
+                    out += _REPLACEMENT
+                    high = 0
+                out += buf[self._pos:]
+                if not self._fill():
+                    raise ValueError("syntax error in JSON: unterminated string")
+                continue
+            if quote != -1 and (escape == -1 or quote < escape):
+                if high:
+                    out += _REPLACEMENT
+                out += buf[self._pos:quote]
+                self._pos = quote + 1
+                return out.decode('utf-8')
+
+            if high and self._pos < escape:
+                out += _REPLACEMENT
+                high = 0
+            out += buf[self._pos:escape]
+            self._pos = escape + 1
+            c = self._next()
+            if c == ord('u'):
+                code = int(bytes(self._next() for _ in range(4)), 16)
+                if high:
+                    if 0xDC00 <= code <= 0xDFFF:
+                        code = 0x10000 + ((high - 0xD800) << 10) + (code - 0xDC00)
+                    else:
+                        out += _REPLACEMENT
+                    high = 0
+                if 0xD800 <= code <= 0xDBFF:
+                    high = code
+                elif 0xDC00 <= code <= 0xDFFF:
+                    # Surrogates alone can't be encoded as UTF-8
+                    out += _REPLACEMENT
+                else:
+                    out += chr(code).encode('utf-8')
+            elif c in _ESCAPES:
+                if high:
+                    out += _REPLACEMENT
+                    high = 0
+                out += _ESCAPES[c].encode('utf-8')
+            else:
+                raise ValueError("syntax error in JSON: bad escape")
+
+    def _skip_string(self):
+        """Step over a string without decoding it"""
+        self._pos += 1
+        while True:
+            buf = self._buf
+            quote = buf.find(b'"', self._pos)
+            escape = buf.find(b'\\', self._pos)
+            if quote == -1 and escape == -1:
+                if not self._fill():
+                    raise ValueError("syntax error in JSON: unterminated string")
+                continue
+            if quote != -1 and (escape == -1 or quote < escape):
+                self._pos = quote + 1
+                return
+            # The escaped character can't end the string
+            self._pos = escape + 1
+            self._next()
+
+    def _skip_container(self):
+        """Step over an object or array, counting brackets"""
+        self._pos += 1
+        depth = 1
+        while depth:
+            c = self._peek()
+            if c == _QUOTE:
+                self._skip_string()
+                continue
+            if c == -1:
+                raise ValueError("syntax error in JSON: unexpected end of data")
+            self._pos += 1
+            if c == _OPEN_OBJECT or c == _OPEN_ARRAY:
+                depth += 1
+            elif c == _CLOSE_OBJECT or c == _CLOSE_ARRAY:
+                depth -= 1
+
+    def _peek(self):
+        """
+        Skip whitespace and return the next byte without consuming it
+
+        Returns:
+            The byte value, or -1 at the end of the data
+        """
+        while True:
+            buf = self._buf
+            pos = self._pos
+            end = len(buf)
+            while pos < end and buf[pos] in _WHITESPACE:
+                pos += 1
+            self._pos = pos
+            if pos < end:
+                return buf[pos]
+            if not self._fill():
+                return -1
+
+    def _next(self):
+        """Consume and return the next byte, whitespace included"""
+        if self._pos >= len(self._buf) and not self._fill():
+            raise ValueError("syntax error in JSON: unexpected end of data")
+        c = self._buf[self._pos]
+        self._pos += 1
+        return c
+
+    def _fill(self):
+        """
+        Replace the consumed buffer with the next chunk
+
+        Returns:
+            False at the end of the data
+        """
+        for chunk in self._chunks:
+            if chunk:
+                self._buf = bytes(chunk)
+                self._pos = 0
+                return True
+        self._buf = b""
+        self._pos = 0
+        return False
+
+
+def _read_chunks(reader, chunk_size):
+    """Yield chunks from an object with read(size) until it is exhausted"""
+    while True:
+        chunk = reader.read(chunk_size)
+        if not chunk:
+            return
+        yield chunk
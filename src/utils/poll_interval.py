@@ -0,0 +1,83 @@
+"""
+Adaptive interval between data refreshes.
+Copyright 2024 3DUPFitters LLC
+"""
+import random
+
+
+class AdaptivePollInterval:
+    """
+    Picks how long to wait before the next refresh
+
+    Starts at the base interval. Backs off gradually when nothing is open
+    or the data came back unchanged, polls faster when wait times are
+    moving quickly, and returns to the base interval otherwise, including
+    after a failed refresh so an error is retried promptly. Every interval
+    gets random jitter so signs that booted together drift apart
+    instead of hitting the API in sync.
+    """
+
+    def __init__(self, base=300, min_interval=120, max_interval=1800,
+                 backoff=1.5, volatile_change=5.0, jitter=0.1):
+        """
+        Initialize the policy
+
+        Args:
+            base: Interval in seconds while data changes at a normal pace
+            min_interval: Shortest interval in seconds
+            max_interval: Longest interval in seconds
+            backoff: Factor the interval grows by per unchanged or closed refresh
+            volatile_change: Mean wait time change in minutes per ride
+                at which polling speeds up
+            jitter: Fraction of the interval to randomize by, e.g. 0.1 for +/-10%
+        """
+        self.min_interval = min(min_interval, max_interval)
+        self.max_interval = max_interval
+        self.base = min(max(base, self.min_interval), self.max_interval)
+        self.backoff = backoff
+        self.volatile_change = volatile_change
+        self.jitter = jitter
+        self.interval = self.base
+
+    def update(self, changed, active=True, change_rate=0.0, failed=False):
+        """
+        Adjust the interval after a refresh
+
+        Args:
+            changed: Whether the refresh brought different data
+            active: Whether anything being shown is open
+            change_rate: Mean absolute wait time change in minutes per ride
+            failed: Whether the refresh got no data at all
+
+        Returns:
+            Seconds to wait before the next refresh, with jitter applied
+        """
+        if failed:
+            # Nothing was learned, so don't back off on stale data
+            self.interval = self.base
+        elif not active or not changed:
+            # Ramp rather than jump, so a park that only looks closed for
+            # a moment (e.g. every ride down in a storm) isn't missed for long
+            self.interval = min(self.interval * self.backoff, self.max_interval)
+        elif change_rate >= self.volatile_change:
+            self.interval = max(self.interval / 2, self.min_interval)
+        else:
+            self.interval = self.base
+        return self.next_delay()
+
+    def reset(self):
+        """Go back to the base interval, e.g. after the settings changed"""
+        self.interval = self.base
+
+    def next_delay(self):
+        """
+        Get the current interval with jitter applied
+
+        Returns:
+            Seconds to wait, within min_interval and max_interval
+        """
+        spread = self.interval * self.jitter
+        # Jitter inside the bounds so delays don't pile up at a limit
+        low = max(self.interval - spread, self.min_interval)
+        high = min(self.interval + spread, self.max_interval)
+        return random.uniform(low, high)
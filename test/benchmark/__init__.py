@@ -0,0 +1,3 @@
+"""
+Offline benchmarking of the network path against a local queue-times.com stand-in.
+"""
@@ -0,0 +1,283 @@
+"""
+Local stand-in for the queue-times.com API.
+
+Serves /parks.json and /parks/<id>/queue_times.json from the test
+fixtures over real sockets, with a load profile that adds latency,
+limits bandwidth, injects bursts of 5xx errors and grows the payload.
+Like the desktop adapter in sldk.web.adapters it runs http.server on a
+background thread, but it writes response bodies itself so they can
+be throttled.
+"""
+import json
+import os
+import random
+import threading
+import time
+import zlib
+from http.server import ThreadingHTTPServer, BaseHTTPRequestHandler
+
+FIXTURES_DIR = os.path.join(os.path.dirname(os.path.dirname(__file__)), 'fixtures')
+
+# Fixtures used as ride data, assigned to parks by id
+RIDE_FIXTURES = ('magic-kingdom.json', 'universal.json', 'epcot-test-data.json')
+
+# Bytes written per throttled chunk
+CHUNK_SIZE = 512
+
+
+class LoadProfile:
+    """How the stand-in server behaves"""
+
+    def __init__(self, latency=0.0, jitter=0.0, bandwidth=None, error_rate=0.0,
+                 error_burst=1, error_status=503, rides_per_park=None, churn=1.0, seed=None):
+        """
+        Initialize a profile
+
+        Args:
+            latency: Seconds before the response headers are sent
+            jitter: Random extra latency of up to this many seconds
+            bandwidth: Body bytes per second, or None for unthrottled
+            error_rate: Chance that a request starts a burst of errors
+            error_burst: Number of consecutive requests a burst fails
+            error_status: HTTP status of injected errors
+            rides_per_park: Rides in each park's payload; None serves the fixtures as-is
+            churn: Chance that a park's wait times changed since the last request
+            seed: Random seed for reproducible runs
+        """
+        self.latency = latency
+        self.jitter = jitter
+        self.bandwidth = bandwidth
+        self.error_rate = error_rate
+        self.error_burst = error_burst
+        self.error_status = error_status
+        self.rides_per_park = rides_per_park
+        self.churn = churn
+        self.seed = seed
+
+
+# Named profiles for the benchmark runner
+PROFILES = {
+    "local": LoadProfile(),
+    "wifi": LoadProfile(latency=0.08, jitter=0.04, bandwidth=200000),
+    "slow": LoadProfile(latency=0.4, jitter=0.2, bandwidth=8000),
+    "flaky": LoadProfile(latency=0.08, jitter=0.04, error_rate=0.15, error_burst=2),
+    "large": LoadProfile(latency=0.08, bandwidth=200000, rides_per_park=400),
+    "quiet": LoadProfile(latency=0.08, churn=0.0),
+}
+
+
+class QueueTimesServer:
+    """
+    Serves the queue-times.com endpoints the app uses
+
+    Each park keeps its current payload and ETag. With probability
+    churn a request sees new wait times; otherwise a request carrying
+    the ETag in If-None-Match gets 304 Not Modified, as it would from
+    the real API's CDN.
+    """
+
+    def __init__(self, profile=None, fixtures_dir=FIXTURES_DIR):
+        """
+        Initialize the server
+
+        Args:
+            profile: A LoadProfile (defaults to the "local" profile)
+            fixtures_dir: Directory holding the fixture JSON files
+        """
+        self.profile = profile or PROFILES["local"]
+        self.fixtures_dir = fixtures_dir
+        self.random = random.Random(self.profile.seed)
+        self._lock = threading.Lock()
+        self._server = None
+        self._thread = None
+        self._parks = {}
+        self._errors_left = 0
+        self._templates = [self._load(name) for name in RIDE_FIXTURES]
+        self._park_list = self._encode(self._load('theme-park-list.json'))
+        self.reset_stats()
+
+    def reset_stats(self):
+        """Zero the request counters"""
+        with self._lock:
+            self.requests = 0
+            self.errors_sent = 0
+            self.not_modified_sent = 0
+            self.bytes_sent = 0
+            self.paths = {}
+
+    def start(self, host="127.0.0.1", port=0):
+        """
+        Start serving on a background thread
+
+        Args:
+            host: Interface to bind
+            port: Port to bind; 0 picks a free one
+
+        Returns:
+            The server's base URL, e.g. http://127.0.0.1:54321
+        """
+        stand_in = self
+
+        class Handler(BaseHTTPRequestHandler):
+            # HTTP/1.1 so clients can keep connections alive
+            protocol_version = "HTTP/1.1"
+
+            def log_message(self, format, *args):
+                pass
+
+            def do_GET(self):
+                stand_in._handle(self)
+
+        self._server = ThreadingHTTPServer((host, port), Handler)
+        self._server.daemon_threads = True
+        self._thread = threading.Thread(target=self._server.serve_forever, daemon=True)
+        self._thread.start()
+        return self.base_url
+
+    def stop(self):
+        """Stop the server"""
+        if self._server:
+            self._server.shutdown()
+            self._server.server_close()
+            self._server = None
+            self._thread = None
+
+    @property
+    def is_running(self):
+        """Whether the server is serving requests"""
+        return self._server is not None
+
+    @property
+    def base_url(self):
+        """The URL the server is reachable at"""
+        host, port = self._server.server_address[:2]
+        return f"http://{host}:{port}"
+
+    def _handle(self, handler):
+        """Answer one request"""
+        path = handler.path.split("?", 1)[0]
+        with self._lock:
+            self.requests += 1
+            self.paths[path] = self.paths.get(path, 0) + 1
+            fail = self._next_is_error()
+
+        self._delay()
+        if fail:
+            with self._lock:
+                self.errors_sent += 1
+            self._send(handler, self.profile.error_status, b'{"error": "injected"}')
+            return
+
+        if path == "/parks.json":
+            self._send(handler, 200, self._park_list)
+            return
+
+        park_id = _park_id(path)
+        if park_id is None:
+            self._send(handler, 404, b'{"error": "not found"}')
+            return
+
+        body, etag = self._park_payload(park_id)
+        if handler.headers.get("If-None-Match") == etag:
+            with self._lock:
+                self.not_modified_sent += 1
+            self._send(handler, 304, b"", etag)
+            return
+        self._send(handler, 200, body, etag)
+
+    def _next_is_error(self):
+        """Decide whether this request is part of an error burst; call with the lock held"""
+        if self._errors_left > 0:
+            self._errors_left -= 1
+            return True
+        if self.profile.error_rate and self.random.random() < self.profile.error_rate:
+            self._errors_left = self.profile.error_burst - 1
+            return True
+        return False
+
+    def _delay(self):
+        """Wait out the profile's latency"""
+        delay = self.profile.latency
+        if self.profile.jitter:
+            with self._lock:
+                delay += self.random.uniform(0, self.profile.jitter)
+        if delay > 0:
+            time.sleep(delay)
+
+    def _send(self, handler, status, body, etag=None):
+        """Write a response, throttled to the profile's bandwidth"""
+        handler.send_response(status)
+        handler.send_header("Content-Type", "application/json")
+        if etag:
+            handler.send_header("ETag", etag)
+        handler.send_header("Content-Length", str(len(body)))
+        handler.end_headers()
+
+        bandwidth = self.profile.bandwidth
+        if not bandwidth:
+            handler.wfile.write(body)
+        else:
+            for start in range(0, len(body), CHUNK_SIZE):
+                chunk = body[start:start + CHUNK_SIZE]
+                handler.wfile.write(chunk)
+                handler.wfile.flush()
+                time.sleep(len(chunk) / bandwidth)
+        with self._lock:
+            self.bytes_sent += len(body)
+
+    def _park_payload(self, park_id):
+        """
+        Get a park's current payload, changing its wait times per the churn
+
+        Returns:
+            Tuple of (body bytes, ETag)
+        """
+        with self._lock:
+            entry = self._parks.get(park_id)
+            if entry is None or self.random.random() < self.profile.churn:
+                data = self._park_data(park_id, entry is None)
+                body = self._encode(data)
+                entry = (body, '"%08x"' % zlib.crc32(body))
+                self._parks[park_id] = entry
+            return entry
+
+    def _park_data(self, park_id, first):
+        """Build a park's wait time data; call with the lock held"""
+        template = self._templates[park_id % len(self._templates)]
+        rides = [ride for land in template.get("lands", []) for ride in land["rides"]]
+        rides.extend(template.get("rides", []))
+        count = self.profile.rides_per_park or len(rides)
+
+        lands = []
+        land = None
+        for n in range(count):
+            ride = dict(rides[n % len(rides)])
+            if n >= len(rides):
+                # Copies past the fixture's rides need their own id and name
+                ride["id"] = ride["id"] + 100000 * (n // len(rides))
+                ride["name"] = f"{ride['name']} {n // len(rides) + 1}"
+            if not first and ride["is_open"]:
+                ride["wait_time"] = max(5, ride["wait_time"] + self.random.choice((-5, 0, 5)))
+            if n % 10 == 0:
+                land = {"id": len(lands) + 1, "name": f"Land {len(lands) + 1}", "rides": []}
+                lands.append(land)
+            land["rides"].append(ride)
+        return {"lands": lands, "rides": []}
+
+    def _load(self, name):
+        """Read a fixture file"""
+        with open(os.path.join(self.fixtures_dir, name)) as f:
+            return json.load(f)
+
+    @staticmethod
+    def _encode(data):
+        """Encode a payload as compact JSON bytes"""
+        return json.dumps(data, separators=(",", ":")).encode("utf-8")
+
+
+def _park_id(path):
+    """Get the park id from a /parks/<id>/queue_times.json path, or None"""
+    parts = path.strip("/").split("/")
+    if len(parts) == 3 and parts[0] == "parks" and parts[2] == "queue_times.json" and parts[1].isdigit():
+        return int(parts[1])
+    return None
@@ -0,0 +1,177 @@
+"""
+Measure ThemeParkService refreshes against the local queue-times.com stand-in.
+
+Runs the real service and HTTP client over sockets to a
+QueueTimesServer and reports, per refresh, the wall time, requests
+and retries, errors and 304s served, bytes received, connections
+opened and reused, and the Python heap high-water mark.
+
+Usage:
+    python -m test.benchmark.refresh_benchmark --profile flaky --rounds 5
+    python -m test.benchmark.refresh_benchmark --profile large --keep-alive --parks 6,5,7,8
+"""
+import argparse
+import asyncio
+import copy
+import gc
+import time
+import tracemalloc
+
+from src.api.theme_park_service import ThemeParkService
+from src.network.http_client import HttpClient
+from test.benchmark.queue_times_server import QueueTimesServer, PROFILES
+
+QUEUE_TIMES_URL = "https://queue-times.com"
+
+# Walt Disney World: Magic Kingdom, Epcot, Hollywood Studios, Animal Kingdom
+DEFAULT_PARK_IDS = (6, 5, 7, 8)
+
+
+class LocalHttpClient(HttpClient):
+    """An HttpClient whose queue-times.com requests go to the stand-in server"""
+
+    def __init__(self, base_url, keep_alive=False):
+        """
+        Initialize the client
+
+        Args:
+            base_url: The stand-in server's base URL
+            keep_alive: Reuse connections, as HttpClient(keep_alive=True) does
+        """
+        super().__init__(keep_alive=keep_alive)
+        self.base_url = base_url
+
+    def local_url(self, url):
+        """Point a queue-times.com URL at the stand-in server"""
+        if url.startswith(QUEUE_TIMES_URL):
+            return self.base_url + url[len(QUEUE_TIMES_URL):]
+        return url
+
+    async def get(self, url, headers=None, max_retries=3, conditional=False):
+        return await super().get(self.local_url(url), headers, max_retries, conditional)
+
+    def forget_validators(self, url):
+        super().forget_validators(self.local_url(url))
+
+
+async def run_benchmark(profile, park_ids=DEFAULT_PARK_IDS, rounds=3, keep_alive=False,
+                        max_concurrent=2):
+    """
+    Refresh the selected parks several times against a stand-in server
+
+    Args:
+        profile: The LoadProfile for the server
+        park_ids: IDs of the parks to select
+        rounds: Number of refreshes to time
+        keep_alive: Use a keep-alive connection pool
+        max_concurrent: The service's max_concurrent_fetches
+
+    Returns:
+        List of one result dictionary per refresh
+    """
+    server = QueueTimesServer(profile)
+    client = LocalHttpClient(server.start(), keep_alive)
+    try:
+        service = ThemeParkService(client, None)
+        service.max_concurrent_fetches = max_concurrent
+        park_list = await service.fetch_park_list()
+        selected = [park_list.get_park_by_id(park_id) for park_id in park_ids]
+        park_list.selected_parks = [park for park in selected if park]
+        if not park_list.selected_parks:
+            raise ValueError(f"None of the parks {park_ids} are in the park list")
+        park_list.current_park = park_list.selected_parks[0]
+
+        results = []
+        for _ in range(rounds):
+            results.append(await _timed_refresh(service, server, client))
+        return results
+    finally:
+        client.close()
+        server.stop()
+
+
+async def _timed_refresh(service, server, client):
+    """Run and measure one refresh of the selected parks"""
+    pool = client.connection_pool
+    opened = pool.connections_opened if pool else 0
+    reused = pool.connections_reused if pool else 0
+    collections = _gc_collections()
+    server.reset_stats()
+    gc.collect()
+
+    tracemalloc.start()
+    started = time.monotonic()
+    updated = await service.update_selected_parks()
+    elapsed = time.monotonic() - started
+    _, peak = tracemalloc.get_traced_memory()
+    tracemalloc.stop()
+
+    parks = len(service.park_list.selected_parks)
+    return {
+        "seconds": elapsed,
+        "parks": parks,
+        "updated": updated,
+        "changed": service.data_changed,
+        "requests": server.requests,
+        "retries": max(0, server.requests - parks),
+        "errors": server.errors_sent,
+        "not_modified": server.not_modified_sent,
+        "bytes": server.bytes_sent,
+        "opened": (pool.connections_opened - opened) if pool else server.requests,
+        "reused": (pool.connections_reused - reused) if pool else 0,
+        "peak_kb": peak / 1024,
+        "gc_runs": _gc_collections() - collections,
+    }
+
+
+def _gc_collections():
+    """Get the number of garbage collections run so far"""
+    return sum(stats["collections"] for stats in gc.get_stats())
+
+
+COLUMNS = (("seconds", "time s", "{:.2f}"), ("updated", "ok", "{}"), ("requests", "reqs", "{}"),
+           ("retries", "retry", "{}"), ("errors", "5xx", "{}"), ("not_modified", "304", "{}"),
+           ("bytes", "bytes", "{}"), ("opened", "conns", "{}"), ("reused", "reuse", "{}"),
+           ("peak_kb", "peak KB", "{:.0f}"), ("gc_runs", "gc", "{}"))
+
+
+def format_results(results):
+    """Format benchmark results as a table with a mean row"""
+    lines = ["round " + " ".join(f"{title:>8}" for _, title, _ in COLUMNS)]
+    for n, result in enumerate(results, 1):
+        lines.append(f"{n:>5} " + " ".join(f"{fmt.format(result[key]):>8}" for key, _, fmt in COLUMNS))
+    if results:
+        mean = {key: sum(result[key] for result in results) / len(results) for key, _, _ in COLUMNS}
+        lines.append(" mean " + " ".join(f"{mean[key]:>8.2f}" for key, _, _ in COLUMNS))
+    return "\n".join(lines)
+
+
+def main(argv=None):
+    """Run the benchmark from the command line"""
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--profile", choices=sorted(PROFILES), default="wifi")
+    parser.add_argument("--parks", default=",".join(str(park_id) for park_id in DEFAULT_PARK_IDS),
+                        help="comma separated park IDs")
+    parser.add_argument("--rounds", type=int, default=3)
+    parser.add_argument("--keep-alive", action="store_true", help="reuse connections")
+    parser.add_argument("--concurrency", type=int, default=2, help="max_concurrent_fetches")
+    parser.add_argument("--rides", type=int, help="rides per park, overriding the profile")
+    parser.add_argument("--seed", type=int, help="random seed for reproducible runs")
+    args = parser.parse_args(argv)
+
+    profile = copy.copy(PROFILES[args.profile])
+    if args.rides is not None:
+        profile.rides_per_park = args.rides
+    if args.seed is not None:
+        profile.seed = args.seed
+    park_ids = [int(park_id) for park_id in args.parks.split(",") if park_id]
+
+    results = asyncio.run(run_benchmark(profile, park_ids, args.rounds, args.keep_alive,
+                                        args.concurrency))
+    print(f"profile={args.profile} parks={park_ids} keep_alive={args.keep_alive} "
+          f"concurrency={args.concurrency}")
+    print(format_results(results))
+
+
+if __name__ == "__main__":
+    main()
@@ -6,7 +6,8 @@ import asyncio
 import pytest
 from unittest.mock import patch, MagicMock, AsyncMock
 
-from src.api.theme_park_service import ThemeParkService
+from src.api.theme_park_service import ThemeParkService, NOT_MODIFIED
+from src.utils.flash_cache import FlashCache
 from src.models.theme_park import ThemePark
 from src.models.theme_park_list import ThemeParkList
 from src.models.vacation import Vacation
@@ -244,7 +245,7 @@ class TestThemeParkService:
             result = await service.update_current_park()
             
             # Verify fetch_park_data was called
-            mock_fetch.assert_called_once_with(1)
+            mock_fetch.assert_called_once_with(1, keep_validators=True)
             
             # Verify park.update was called
             mock_park.update.assert_called_once_with(park_data)
@@ -327,7 +328,7 @@ class TestThemeParkService:
             result = await service.update_current_park()
             
             # Verify fetch_park_data was called
-            mock_fetch.assert_called_once_with(1)
+            mock_fetch.assert_called_once_with(1, keep_validators=True)
             
             # Verify park.update was not called
             mock_park.update.assert_not_called()
@@ -472,4 +473,301 @@ class TestThemeParkService:
         
         # Verify no methods were called since park_list is None
         mock_vacation.parse.assert_not_called()
-        service.save_settings.assert_not_called()
\ No newline at end of file
+        service.save_settings.assert_not_called()
+    
+    @pytest.mark.asyncio
+    async def test_fetch_park_data_not_modified(self):
+        """Test that a 304 is reported without parsing a body"""
+        mock_http = MagicMock()
+        mock_settings = MagicMock()
+        
+        mock_response = MagicMock()
+        mock_response.status_code = 304
+        mock_http.get = AsyncMock(return_value=mock_response)
+        
+        service = ThemeParkService(mock_http, mock_settings)
+        result = await service.fetch_park_data(1, if_modified=True)
+        
+        mock_http.get.assert_called_once_with("https://queue-times.com/parks/1/queue_times.json",
+                                              conditional=True)
+        mock_response.close.assert_called_once()
+        assert result is NOT_MODIFIED
+    
+    @pytest.mark.asyncio
+    async def test_fetch_park_data_keeps_validators(self):
+        """Test that a full fetch sends no validators but remembers the new ones"""
+        mock_http = MagicMock()
+        mock_settings = MagicMock()
+        
+        calls = []
+        mock_http.forget_validators.side_effect = lambda url: calls.append("forget")
+        async def get(url, conditional=False):
+            calls.append(("get", conditional))
+            return None
+        mock_http.get = get
+        
+        service = ThemeParkService(mock_http, mock_settings)
+        with patch('asyncio.sleep', new_callable=AsyncMock):
+            await service.fetch_park_data(1, keep_validators=True)
+        
+        mock_http.forget_validators.assert_called_with("https://queue-times.com/parks/1/queue_times.json")
+        assert calls[:2] == ["forget", ("get", True)]
+    
+    @pytest.mark.asyncio
+    async def test_update_selected_parks_skips_unchanged(self):
+        """Test that unchanged parks aren't re-parsed and are reported as such"""
+        mock_http = MagicMock()
+        mock_settings = MagicMock()
+        service = ThemeParkService(mock_http, mock_settings)
+        
+        # A park that already holds data gets a conditional request
+        park = MagicMock()
+        park.id = 6
+        park.name = "Magic Kingdom"
+        park.rides = [MagicMock()]
+        
+        mock_park_list = MagicMock()
+        mock_park_list.selected_parks = [park]
+        service.park_list = mock_park_list
+        
+        with patch.object(service, 'fetch_park_data', new_callable=AsyncMock) as mock_fetch:
+            mock_fetch.return_value = NOT_MODIFIED
+            
+            updated = await service.update_selected_parks()
+            
+            mock_fetch.assert_called_once_with(6, if_modified=True)
+            park.update.assert_not_called()
+            assert updated == 1
+            assert service.data_changed is False
+    
+    @pytest.mark.asyncio
+    async def test_update_selected_parks_first_fetch_unconditional(self):
+        """Test that a park without data is always fetched in full and keeps its validators"""
+        mock_http = MagicMock()
+        mock_settings = MagicMock()
+        service = ThemeParkService(mock_http, mock_settings)
+        
+        park = MagicMock()
+        park.id = 6
+        park.name = "Magic Kingdom"
+        park.rides = []
+        
+        mock_park_list = MagicMock()
+        mock_park_list.selected_parks = [park]
+        service.park_list = mock_park_list
+        
+        park_data = {"lands": [], "rides": []}
+        with patch.object(service, 'fetch_park_data', new_callable=AsyncMock) as mock_fetch:
+            mock_fetch.return_value = park_data
+            
+            await service.update_selected_parks()
+            
+            mock_fetch.assert_called_once_with(6, keep_validators=True)
+            park.update.assert_called_once_with(park_data)
+            assert service.data_changed is True
+    
+    @pytest.mark.asyncio
+    async def test_fetch_park_data_streams_native_response(self):
+        """Test that a native response is parsed from the socket in chunks"""
+        body = json.dumps({"lands": [{"id": 1, "name": "Land", "rides": [
+            {"id": 101, "name": "Space Mountain", "is_open": True, "wait_time": 45,
+             "last_updated": "2023-04-12T10:30:00Z"}]}], "rides": []}).encode('utf-8')
+        
+        class NativeResponse:
+            status_code = 200
+            closed = False
+            drained = False
+            chunk_sizes = []
+            
+            def iter_content(self, chunk_size):
+                self.chunk_sizes.append(chunk_size)
+                if self.drained:
+                    return
+                for i in range(0, len(body), 16):
+                    yield body[i:i + 16]
+            
+            # Like adafruit_requests, text drains the socket; touching it
+            # leaves nothing for iter_content to stream
+            @property
+            def text(self):
+                self.drained = True
+                return body.decode('utf-8')
+            
+            def close(self):
+                self.closed = True
+        
+        response = NativeResponse()
+        mock_http = MagicMock()
+        mock_http.using_adafruit = True
+        mock_http.get = AsyncMock(return_value=response)
+        
+        service = ThemeParkService(mock_http, MagicMock())
+        result = await service.fetch_park_data(1)
+        
+        assert response.closed
+        assert not response.drained
+        assert response.chunk_sizes
+        rides = result["lands"][0]["rides"]
+        assert rides == [{"id": 101, "name": "Space Mountain", "is_open": True, "wait_time": 45}]
+    
+    @pytest.mark.asyncio
+    async def test_cached_data_survives_restart(self, tmp_path):
+        """Test that a new service shows the last good data before any fetch"""
+        mock_settings = MagicMock()
+        mock_settings.settings = {"selected_park_ids": [6]}
+        
+        # First run fetches and caches the park list and wait times
+        mock_http = MagicMock()
+        mock_http.get = AsyncMock(return_value=MagicMock(text=json.dumps(
+            [{"parks": [{"id": 6, "name": "Magic Kingdom", "latitude": "28.4", "longitude": "-81.5"}]}])))
+        service = ThemeParkService(mock_http, mock_settings, FlashCache(str(tmp_path)))
+        await service.fetch_park_list()
+        service.park_list.load_settings(mock_settings)
+        park_data = {"lands": [{"rides": [
+            {"id": 101, "name": "Space Mountain", "is_open": True, "wait_time": 45}]}], "rides": []}
+        with patch.object(service, 'fetch_park_data', new_callable=AsyncMock, return_value=park_data):
+            assert await service.update_selected_parks() == 1
+        
+        # After a restart the data is back without touching the network
+        offline_http = MagicMock()
+        offline_http.get = AsyncMock(side_effect=OSError("offline"))
+        restarted = ThemeParkService(offline_http, mock_settings, FlashCache(str(tmp_path)))
+        assert restarted.load_cached()
+        offline_http.get.assert_not_called()
+        park = restarted.park_list.selected_parks[0]
+        assert park.name == "Magic Kingdom"
+        assert park.latitude == "28.4"
+        assert park.is_open
+        assert [(ride.name, ride.wait_time, ride.open_flag) for ride in park.rides] == [
+            ("Space Mountain", 45, True)]
+        
+        # A failed refresh keeps the cached data instead of emptying the list
+        with patch('asyncio.sleep', new_callable=AsyncMock):
+            await restarted.fetch_park_list()
+        assert restarted.park_list.selected_parks[0] is park
+        assert park.rides
+    
+    @pytest.mark.asyncio
+    async def test_refreshed_park_list_keeps_rides(self, tmp_path):
+        """Test that fetching the park list doesn't drop wait times already shown"""
+        mock_settings = MagicMock()
+        mock_settings.settings = {"selected_park_ids": [6]}
+        cache = FlashCache(str(tmp_path))
+        cache.save("parks", [[6, "Magic Kingdom", 0, 0]])
+        cache.save("park_6", [[101, "Space Mountain", 45, True]])
+        
+        mock_http = MagicMock()
+        mock_http.get = AsyncMock(return_value=MagicMock(text=json.dumps(
+            [{"parks": [{"id": 6, "name": "Magic Kingdom"}, {"id": 5, "name": "Epcot"}]}])))
+        service = ThemeParkService(mock_http, mock_settings, cache)
+        assert service.load_cached()
+        
+        await service.fetch_park_list()
+        service.park_list.load_settings(mock_settings)
+        
+        assert len(service.park_list.park_list) == 2
+        assert service.park_list.selected_parks[0].rides[0].wait_time == 45
+    
+    @pytest.mark.asyncio
+    async def test_failed_update_falls_back_to_cache(self, tmp_path):
+        """Test that a park with no data uses cached wait times when its fetch fails"""
+        cache = FlashCache(str(tmp_path))
+        cache.save("park_6", [[101, "Space Mountain", 45, True]])
+        service = ThemeParkService(MagicMock(), MagicMock(), cache)
+        
+        park = ThemePark("", "Magic Kingdom", 6)
+        mock_park_list = MagicMock()
+        mock_park_list.selected_parks = [park]
+        service.park_list = mock_park_list
+        
+        with patch.object(service, 'fetch_park_data', new_callable=AsyncMock, return_value=None):
+            assert await service.update_selected_parks() == 1
+        
+        assert service.data_changed is True
+        assert park.rides[0].name == "Space Mountain"
+    
+    def test_load_cached_without_cache(self):
+        """Test that nothing is restored when no cache is configured"""
+        service = ThemeParkService(MagicMock(), MagicMock())
+        assert service.load_cached() is False
+        assert service.park_list is None
+    
+    @pytest.mark.asyncio
+    async def test_update_selected_parks_current_park_first(self):
+        """Test that the current park is fetched first and fetches are limited"""
+        service = ThemeParkService(MagicMock(), MagicMock())
+        service.max_concurrent_fetches = 1
+        
+        parks = []
+        for park_id in (1, 2, 3):
+            park = MagicMock()
+            park.id = park_id
+            park.rides = []
+            parks.append(park)
+        mock_park_list = MagicMock()
+        mock_park_list.selected_parks = parks
+        mock_park_list.current_park = parks[2]
+        service.park_list = mock_park_list
+        
+        with patch.object(service, 'fetch_park_data', new_callable=AsyncMock) as mock_fetch:
+            mock_fetch.return_value = {"lands": [], "rides": []}
+            
+            assert await service.update_selected_parks() == 3
+            
+            assert [call.args[0] for call in mock_fetch.call_args_list] == [3, 1, 2]
+    
+    @pytest.mark.asyncio
+    async def test_update_needed_cancels_update_in_progress(self):
+        """Test that a settings change stops the parks not fetched yet"""
+        service = ThemeParkService(MagicMock(), MagicMock())
+        service.max_concurrent_fetches = 1
+        
+        parks = []
+        for park_id in (1, 2):
+            park = MagicMock()
+            park.id = park_id
+            park.rides = []
+            parks.append(park)
+        mock_park_list = MagicMock()
+        mock_park_list.selected_parks = parks
+        mock_park_list.current_park = parks[0]
+        service.park_list = mock_park_list
+        
+        async def fetch(park_id, **kwargs):
+            # The web server flags an update while the first park loads
+            service.update_needed = True
+            return {"lands": [], "rides": []}
+        
+        with patch.object(service, 'fetch_park_data', side_effect=fetch) as mock_fetch:
+            assert await service.update_selected_parks() == 1
+            
+            assert mock_fetch.call_count == 1
+            parks[1].update.assert_not_called()
+            assert service.update_needed is True
+    
+    @pytest.mark.asyncio
+    async def test_update_records_wait_time_change(self):
+        """Test that the mean wait time change and open state are tracked"""
+        service = ThemeParkService(MagicMock(), MagicMock())
+        park = ThemePark({"rides": [
+            {"id": 1, "name": "A", "wait_time": 10, "is_open": True},
+            {"id": 2, "name": "B", "wait_time": 20, "is_open": True}]}, "Park", 6)
+        mock_park_list = MagicMock()
+        mock_park_list.selected_parks = [park]
+        service.park_list = mock_park_list
+        
+        park_data = {"rides": [
+            {"id": 1, "name": "A", "wait_time": 25, "is_open": True},
+            {"id": 2, "name": "B", "wait_time": 15, "is_open": True},
+            {"id": 3, "name": "C", "wait_time": 60, "is_open": True}]}
+        with patch.object(service, 'fetch_park_data', new_callable=AsyncMock, return_value=park_data):
+            await service.update_selected_parks()
+        
+        assert service.wait_time_change == 10
+        assert service.any_park_open() is True
+        
+        closed_data = {"rides": [{"id": 1, "name": "A", "wait_time": 0, "is_open": False}]}
+        with patch.object(service, 'fetch_park_data', new_callable=AsyncMock, return_value=closed_data):
+            await service.update_selected_parks()
+        
+        assert service.any_park_open() is False
@@ -0,0 +1,93 @@
+"""
+Tests for the packed ride table.
+"""
+from src.models.ride_table import RideTable, RideView
+from src.models.theme_park import ThemePark
+from src.models.theme_park_ride import ThemeParkRide
+
+
+def make_table():
+    table = RideTable()
+    table.append("Space Mountain", 1, 60, True)
+    table.append("Matterhorn", 2, 0, False)
+    table.append("Meet Mickey", 3, 20, True)
+    table.append("Haunted Mansion", 4, 45, True)
+    table.append("Dumbo", 5, 0, True)
+    return table
+
+
+class TestRideTable:
+    def test_rows_read_back(self):
+        """Test that appended rides come back through the arrays and views"""
+        table = make_table()
+        assert len(table) == 5
+        assert table.ids.typecode == 'H'
+        assert list(table.wait_times) == [60, 0, 20, 45, 0]
+        assert [table.open_flag(i) for i in range(5)] == [True, False, True, True, True]
+        assert [table.is_open(i) for i in range(5)] == [True, False, True, True, False]
+
+        ride = table[3]
+        assert isinstance(ride, ThemeParkRide)
+        assert (ride.name, ride.id, ride.wait_time, ride.open_flag) == ("Haunted Mansion", 4, 45, True)
+        assert ride.is_open()
+        assert table[-1].name == "Dumbo"
+        assert [r.name for r in table][:2] == ["Space Mountain", "Matterhorn"]
+
+    def test_open_flags_span_bytes(self):
+        """Test the bitfield past the first byte"""
+        table = RideTable()
+        for i in range(20):
+            table.append(f"Ride {i}", i, 10, i % 3 == 0)
+        assert len(table.open_flags) == 3
+        assert [i for i in range(20) if table.open_flag(i)] == [0, 3, 6, 9, 12, 15, 18]
+
+    def test_bad_values(self):
+        """Test that missing or negative numbers are stored as zero"""
+        table = RideTable()
+        table.append("Ride", None, -5, "yes")
+        assert (table.ids[0], table.wait_times[0], table.open_flag(0)) == (0, 0, False)
+
+    def test_large_ids_widen_the_array(self):
+        """Test that an id above 16 bits isn't truncated"""
+        table = make_table()
+        table.append("New Ride", 70000, 5, True)
+        assert table.ids[-1] == 70000
+        assert list(table.ids)[:5] == [1, 2, 3, 4, 5]
+
+    def test_select(self):
+        """Test the meet & greet and closed filters"""
+        table = make_table()
+        assert table.select() == [0, 1, 2, 3, 4]
+        assert table.select(skip_meet=True) == [0, 1, 3, 4]
+        assert table.select(skip_closed=True) == [0, 2, 3]
+
+    def test_sort_key(self):
+        """Test ordering rows for each sort mode"""
+        table = make_table()
+        rows = table.select()
+        assert sorted(rows, key=table.sort_key("alphabetical")) == [4, 3, 1, 2, 0]
+        assert sorted(rows, key=table.sort_key("unknown")) == [4, 3, 1, 2, 0]
+        # Dumbo is marked open with no wait, so it sorts as 0 like Matterhorn
+        assert sorted(rows, key=table.sort_key("max_wait"),
+                      reverse=RideTable.sort_descending("max_wait")) == [0, 3, 2, 1, 4]
+        assert sorted(rows, key=table.sort_key("min_wait"),
+                      reverse=RideTable.sort_descending("min_wait")) == [1, 4, 2, 3, 0]
+
+    def test_from_rides(self):
+        """Test building a table from ride objects"""
+        rides = [ThemeParkRide("A", 1, 5, True), ThemeParkRide("B", 2, 0, False)]
+        table = RideTable.from_rides(rides)
+        assert [(r.name, r.id, r.wait_time, r.open_flag) for r in table] == [
+            ("A", 1, 5, True), ("B", 2, 0, False)]
+        assert table.wait_times_by_id() == {1: 5, 2: 0}
+
+    def test_refresh_shares_names(self):
+        """Test that a refreshed park keeps its earlier string objects"""
+        park = ThemePark({"rides": [{"name": "Space Mountain", "id": 1, "wait_time": 60, "is_open": True}]},
+                         "Park", 7)
+        old_name = park.rides.names[0]
+        park.update({"rides": [{"name": "Space " + "Mountain", "id": 1, "wait_time": 30, "is_open": True}]})
+        assert isinstance(park.rides, RideTable)
+        assert park.rides.names[0] is old_name
+        assert park.get_current_ride_time() == 30
+        assert isinstance(park.rides[0], RideView)
@@ -0,0 +1,139 @@
+"""
+Tests for the keep-alive connection pool.
+"""
+import threading
+import time
+import pytest
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from unittest.mock import patch, MagicMock
+
+from src.network.connection_pool import ConnectionPool
+from src.network.http_client import HttpClient
+
+
+class KeepAliveHandler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    
+    def do_GET(self):
+        if self.path == "/not-modified":
+            self.send_response(304)
+            self.send_header("Content-Length", "0")
+            self.end_headers()
+            return
+        body = b'{"path": "%s"}' % self.path.encode()
+        self.send_response(200)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.send_header("ETag", '"v1"')
+        if self.path == "/close":
+            self.send_header("Connection", "close")
+        if self.path in ("/close", "/drop"):
+            # /drop hangs up without telling the client
+            self.close_connection = True
+        self.end_headers()
+        self.wfile.write(body)
+        
+    def log_message(self, *args):
+        pass
+
+
+@pytest.fixture
+def server():
+    httpd = ThreadingHTTPServer(("127.0.0.1", 0), KeepAliveHandler)
+    thread = threading.Thread(target=httpd.serve_forever, daemon=True)
+    thread.start()
+    yield "http://127.0.0.1:%d" % httpd.server_address[1]
+    httpd.shutdown()
+    httpd.server_close()
+
+
+class TestConnectionPool:
+    def test_reuses_connection(self, server):
+        """Test that requests to one host share a connection"""
+        pool = ConnectionPool()
+        for path in ("/parks/1", "/parks/2", "/parks/3"):
+            response = pool.request("GET", server + path)
+            assert response.status == 200
+            assert response.read() == b'{"path": "%s"}' % path.encode()
+        
+        assert pool.connections_opened == 1
+        assert pool.connections_reused == 2
+        assert pool.idle_count() == 1
+        pool.close_all()
+        assert pool.idle_count() == 0
+        
+    def test_connection_close_is_not_pooled(self, server):
+        """Test that a connection the server will close isn't kept"""
+        pool = ConnectionPool()
+        pool.request("GET", server + "/close")
+        assert pool.idle_count() == 0
+        pool.request("GET", server + "/parks/1")
+        assert pool.connections_opened == 2
+        
+    def test_idle_connections_expire(self, server):
+        """Test that connections idle too long are replaced"""
+        pool = ConnectionPool(idle_timeout=0)
+        pool.request("GET", server + "/parks/1")
+        with patch('src.network.connection_pool.time.monotonic', return_value=1e9):
+            pool.request("GET", server + "/parks/2")
+        assert pool.connections_opened == 2
+        assert pool.connections_reused == 0
+        
+    def test_health_check_discards_closed_connection(self, server):
+        """Test that a connection the server hung up on isn't reused"""
+        pool = ConnectionPool()
+        pool.request("GET", server + "/drop")
+        assert pool.idle_count() == 1
+        time.sleep(0.05)
+        
+        response = pool.request("GET", server + "/parks/1")
+        
+        assert response.status == 200
+        assert pool.connections_opened == 2
+        assert pool.connections_reused == 0
+        
+    def test_reconnects_when_server_closed_connection(self, server):
+        """Test the fallback when a reused connection fails anyway"""
+        pool = ConnectionPool()
+        pool.request("GET", server + "/drop")
+        time.sleep(0.05)
+        
+        with patch('src.network.connection_pool._is_alive', return_value=True):
+            response = pool.request("GET", server + "/parks/2")
+        
+        assert response.status == 200
+        assert response.read() == b'{"path": "/parks/2"}'
+        assert pool.connections_reused == 1
+        assert pool.connections_opened == 2
+        
+    def test_rejects_unsupported_url(self):
+        """Test that only http and https URLs are accepted"""
+        with pytest.raises(ValueError):
+            ConnectionPool().request("GET", "ftp://example.com/file")
+
+
+class TestHttpClientKeepAlive:
+    @pytest.mark.asyncio
+    async def test_get_uses_pool(self, server):
+        """Test that a keep-alive client reuses its connection and remembers validators"""
+        client = HttpClient(keep_alive=True)
+        client.using_adafruit = False
+        
+        first = await client.get(server + "/parks/1", conditional=True)
+        second = await client.get(server + "/parks/2")
+        
+        assert first.status_code == 200
+        assert second.json() == {"path": "/parks/2"}
+        assert client.connection_pool.connections_opened == 1
+        assert client._validators[server + "/parks/1"] == ('"v1"', None)
+        client.close()
+        
+    @pytest.mark.asyncio
+    async def test_not_modified_through_pool(self, server):
+        """Test that a 304 comes back as a not-modified response"""
+        client = HttpClient(keep_alive=True)
+        
+        response = await client.get(server + "/not-modified")
+        
+        assert response.status_code == 304
+        assert response.text == ""
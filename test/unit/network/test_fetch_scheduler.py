@@ -0,0 +1,109 @@
+"""
+Tests for the bounded-concurrency fetch scheduler.
+"""
+import asyncio
+import pytest
+
+from src.network.fetch_scheduler import FetchScheduler, CANCELLED
+
+
+class Recorder:
+    """Fake fetches that record how many run at once"""
+
+    def __init__(self):
+        self.active = {}
+        self.peak = 0
+        self.peak_by_host = {}
+        self.started = []
+
+    def fetch(self, host, name, result=None, error=None):
+        async def run():
+            self.started.append(name)
+            self.active[host] = self.active.get(host, 0) + 1
+            self.peak = max(self.peak, sum(self.active.values()))
+            self.peak_by_host[host] = max(self.peak_by_host.get(host, 0), self.active[host])
+            await asyncio.sleep(0.01)
+            self.active[host] -= 1
+            if error:
+                raise error
+            return result if result is not None else name
+        return run
+
+
+class TestFetchScheduler:
+    @pytest.mark.asyncio
+    async def test_limits_concurrency_and_keeps_result_order(self):
+        """Test that no more than max_concurrent fetches run at once"""
+        recorder = Recorder()
+        scheduler = FetchScheduler(max_concurrent=2, per_host=4)
+        for i in range(5):
+            scheduler.add("a.com", recorder.fetch("a.com", i))
+        
+        results = await scheduler.run()
+        
+        assert results == [0, 1, 2, 3, 4]
+        assert recorder.peak == 2
+        
+    @pytest.mark.asyncio
+    async def test_per_host_limit(self):
+        """Test that a busy host doesn't hold up jobs for other hosts"""
+        recorder = Recorder()
+        scheduler = FetchScheduler(max_concurrent=3, per_host=1)
+        for i in range(3):
+            scheduler.add("a.com", recorder.fetch("a.com", "a%d" % i))
+        scheduler.add("b.com", recorder.fetch("b.com", "b0"))
+        
+        await scheduler.run()
+        
+        assert recorder.peak_by_host == {"a.com": 1, "b.com": 1}
+        # b.com starts before the second a.com job
+        assert recorder.started.index("b0") < recorder.started.index("a1")
+        
+    @pytest.mark.asyncio
+    async def test_priority_order(self):
+        """Test that lower priorities start first, then insertion order"""
+        recorder = Recorder()
+        scheduler = FetchScheduler(max_concurrent=1)
+        scheduler.add("a.com", recorder.fetch("a.com", "later"), priority=1)
+        scheduler.add("a.com", recorder.fetch("a.com", "first"), priority=0)
+        scheduler.add("a.com", recorder.fetch("a.com", "last"), priority=1)
+        
+        await scheduler.run()
+        
+        assert recorder.started == ["first", "later", "last"]
+        
+    @pytest.mark.asyncio
+    async def test_cancel_skips_jobs_not_started(self):
+        """Test that cancel lets the running fetch finish and drops the rest"""
+        scheduler = FetchScheduler(max_concurrent=1)
+        
+        async def cancelling_fetch():
+            scheduler.cancel()
+            return "done"
+        
+        recorder = Recorder()
+        scheduler.add("a.com", cancelling_fetch)
+        scheduler.add("a.com", recorder.fetch("a.com", "skipped"))
+        
+        results = await scheduler.run()
+        
+        assert results == ["done", CANCELLED]
+        assert recorder.started == []
+        
+    @pytest.mark.asyncio
+    async def test_failed_fetch_returns_exception(self):
+        """Test that one failing job doesn't stop the others"""
+        recorder = Recorder()
+        error = OSError("socket pool exhausted")
+        scheduler = FetchScheduler(max_concurrent=2)
+        scheduler.add("a.com", recorder.fetch("a.com", "bad", error=error))
+        scheduler.add("a.com", recorder.fetch("a.com", "good"))
+        
+        results = await scheduler.run()
+        
+        assert results == [error, "good"]
+        
+    @pytest.mark.asyncio
+    async def test_no_jobs(self):
+        """Test running an empty scheduler"""
+        assert await FetchScheduler().run() == []
@@ -127,4 +127,86 @@ class TestHttpClient:
         # Test empty response
         response = MockResponse(status_code=200, text='')
         data = response.json()
-        assert data == {}
\ No newline at end of file
+        assert data == {}    
+    @pytest.mark.asyncio
+    async def test_conditional_get_sends_validators(self):
+        """Test that validators from a 200 are sent back on a conditional GET"""
+        mock_session = MagicMock()
+        first = MagicMock()
+        first.status_code = 200
+        first.headers = {"etag": '"abc123"', "Last-Modified": "Wed, 01 Jan 2025 10:00:00 GMT"}
+        not_modified = MagicMock()
+        not_modified.status_code = 304
+        mock_session.get.side_effect = [first, not_modified]
+        
+        client = HttpClient(session=mock_session)
+        client.using_adafruit = True
+        url = "https://queue-times.com/parks/6/queue_times.json"
+        
+        await client.get(url, conditional=True)
+        response = await client.get(url, conditional=True)
+        
+        assert response.status_code == 304
+        sent = mock_session.get.call_args_list[1][1]["headers"]
+        assert sent["If-None-Match"] == '"abc123"'
+        assert sent["If-Modified-Since"] == "Wed, 01 Jan 2025 10:00:00 GMT"
+        assert sent["User-Agent"] == "Mozilla/5.0 (CircuitPython)"
+    
+    @pytest.mark.asyncio
+    async def test_plain_get_sends_no_validators(self):
+        """Test that validators are only sent when asked for"""
+        mock_session = MagicMock()
+        response = MagicMock()
+        response.status_code = 200
+        response.headers = {"ETag": '"abc123"'}
+        mock_session.get.return_value = response
+        
+        client = HttpClient(session=mock_session)
+        client.using_adafruit = True
+        url = "https://queue-times.com/parks/6/queue_times.json"
+        
+        await client.get(url)
+        await client.get(url)
+        
+        mock_session.get.assert_called_with(url, headers={"User-Agent": "Mozilla/5.0 (CircuitPython)"})
+        
+        # A plain GET's body may not be stored, so it leaves no validators
+        await client.get(url, conditional=True)
+        assert "If-None-Match" not in mock_session.get.call_args[1]["headers"]
+    
+    @pytest.mark.asyncio
+    async def test_forget_validators(self):
+        """Test that a forgotten URL is fetched unconditionally"""
+        mock_session = MagicMock()
+        response = MagicMock()
+        response.status_code = 200
+        response.headers = {"ETag": '"abc123"'}
+        mock_session.get.return_value = response
+        
+        client = HttpClient(session=mock_session)
+        client.using_adafruit = True
+        url = "https://queue-times.com/parks/6/queue_times.json"
+        
+        await client.get(url, conditional=True)
+        client.forget_validators(url)
+        await client.get(url, conditional=True)
+        
+        assert "If-None-Match" not in mock_session.get.call_args[1]["headers"]
+    
+    @pytest.mark.asyncio
+    async def test_urllib_not_modified(self):
+        """Test that urllib's 304 HTTPError becomes a not-modified response"""
+        from urllib.error import HTTPError
+        
+        client = HttpClient()
+        client.using_adafruit = False
+        client._validators["https://example.com/data.json"] = ('"v1"', None)
+        client.urllib = MagicMock()
+        client.urllib.urlopen.side_effect = HTTPError(
+            "https://example.com/data.json", 304, "Not Modified", {}, None)
+        
+        response = await client.get("https://example.com/data.json", conditional=True)
+        
+        assert response.status_code == 304
+        assert client.urllib.urlopen.call_count == 1
+        client.urllib.Request.return_value.add_header.assert_any_call("If-None-Match", '"v1"')
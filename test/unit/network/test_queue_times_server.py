@@ -0,0 +1,97 @@
+"""
+Tests for the local queue-times.com stand-in server and refresh benchmark.
+"""
+import json
+import urllib.request
+from urllib.error import HTTPError
+
+import pytest
+
+from test.benchmark.queue_times_server import QueueTimesServer, LoadProfile
+from test.benchmark.refresh_benchmark import run_benchmark, format_results
+
+
+def get(url, headers=None):
+    """GET a URL, returning (status, headers, body)"""
+    request = urllib.request.Request(url, headers=headers or {})
+    try:
+        with urllib.request.urlopen(request, timeout=5) as response:
+            return response.status, response.headers, response.read()
+    except HTTPError as e:
+        return e.code, e.headers, e.read()
+
+
+@pytest.fixture
+def serve():
+    servers = []
+
+    def start(profile=None):
+        server = QueueTimesServer(profile)
+        server.start()
+        servers.append(server)
+        return server
+
+    yield start
+    for server in servers:
+        server.stop()
+
+
+class TestQueueTimesServer:
+    def test_serves_park_list_and_wait_times(self, serve):
+        """Test both endpoints and the 304 for an unchanged park"""
+        server = serve(LoadProfile(churn=0.0))
+        status, _, body = get(server.base_url + "/parks.json")
+        assert status == 200
+        assert any(park["id"] == 6 for company in json.loads(body) for park in company["parks"])
+
+        status, headers, body = get(server.base_url + "/parks/6/queue_times.json")
+        assert status == 200
+        assert json.loads(body)["lands"][0]["rides"]
+        etag = headers["ETag"]
+
+        status, _, body = get(server.base_url + "/parks/6/queue_times.json", {"If-None-Match": etag})
+        assert status == 304
+        assert body == b""
+        assert server.not_modified_sent == 1
+
+        assert get(server.base_url + "/parks/x/queue_times.json")[0] == 404
+        assert server.requests == 4
+
+    def test_churn_changes_the_etag(self, serve):
+        """Test that a park with churn comes back modified"""
+        server = serve(LoadProfile(churn=1.0, seed=1))
+        _, headers, _ = get(server.base_url + "/parks/6/queue_times.json")
+        status, _, _ = get(server.base_url + "/parks/6/queue_times.json",
+                           {"If-None-Match": headers["ETag"]})
+        assert status == 200
+
+    def test_error_bursts(self, serve):
+        """Test that injected errors come in bursts of the configured length"""
+        server = serve(LoadProfile(error_rate=1.0, error_burst=3, error_status=502))
+        assert get(server.base_url + "/parks.json")[0] == 502
+        server.profile.error_rate = 0.0
+        assert [get(server.base_url + "/parks.json")[0] for _ in range(3)] == [502, 502, 200]
+        assert server.errors_sent == 3
+
+    def test_payload_size(self, serve):
+        """Test growing a park to a given number of rides"""
+        server = serve(LoadProfile(rides_per_park=120))
+        _, _, body = get(server.base_url + "/parks/6/queue_times.json")
+        rides = [ride for land in json.loads(body)["lands"] for ride in land["rides"]]
+        assert len(rides) == 120
+        assert len({ride["id"] for ride in rides}) == 120
+        assert len({ride["name"] for ride in rides}) == 120
+
+
+class TestRefreshBenchmark:
+    @pytest.mark.asyncio
+    async def test_refreshes_against_the_stand_in(self):
+        """Test a short benchmark run end to end"""
+        results = await run_benchmark(LoadProfile(churn=0.0), park_ids=(6, 5), rounds=2,
+                                      keep_alive=True)
+        assert [result["updated"] for result in results] == [2, 2]
+        assert results[0]["retries"] == 0
+        # The second refresh finds nothing changed and reuses connections
+        assert results[1]["not_modified"] == 2
+        assert results[1]["opened"] == 0
+        assert "peak KB" in format_results(results)
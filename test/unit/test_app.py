@@ -0,0 +1,105 @@
+"""
+Tests for the ThemeParkApp data update and display loop.
+"""
+import asyncio
+import pytest
+from unittest.mock import MagicMock, AsyncMock
+
+from src.app import ThemeParkApp
+from src.models.theme_park import ThemePark
+from src.models.theme_park_list import ThemeParkList
+from src.models.vacation import Vacation
+
+
+def make_park(rides, park_id=1):
+    """Make an open park from (name, id, wait_time) tuples"""
+    json_data = {"rides": [{"name": name, "id": ride_id, "wait_time": wait, "is_open": True}
+                           for name, ride_id, wait in rides]}
+    return ThemePark(json_data, "Test Park", park_id)
+
+
+class TestUpdateData:
+    def setup_method(self):
+        self.settings = {"sort_mode": "alphabetical", "group_by_park": False}
+        settings_manager = MagicMock()
+        settings_manager.get.side_effect = lambda key, default=None: self.settings.get(key, default)
+        self.display = MagicMock()
+        self.display.settings_manager = settings_manager
+        self.display.show_scroll_message = AsyncMock()
+        self.app = ThemeParkApp(self.display, MagicMock(), settings_manager)
+
+        service = MagicMock()
+        service.park_list = MagicMock(spec=ThemeParkList)
+        service.park_list.selected_parks = []
+        service.park_list.skip_closed = False
+        service.park_list.skip_meet = False
+        service.vacation = Vacation()
+        service.update_needed = False
+        service.queue_rebuild_needed = False
+        service.data_changed = True
+        service.wait_time_change = 0.0
+        service.update_current_park = AsyncMock(return_value=True)
+        self.service = service
+        self.app.theme_park_service = service
+
+    async def show_park(self, park):
+        self.service.park_list.current_park = park
+        self.app.message_queue.init()
+        await self.app.build_messages()
+
+    @pytest.mark.asyncio
+    async def test_timer_refresh_keeps_the_cursor(self):
+        """Test that a timed refresh merges into the running queue"""
+        await self.show_park(make_park([("Alpha", 1, 10), ("Beta", 2, 20)]))
+        mq = self.app.message_queue
+        mq.index = 4
+        self.display.stop_current_operation.reset_mock()
+
+        await self.app.update_data(True)
+
+        assert mq.index == 4
+        self.display.stop_current_operation.assert_not_called()
+
+    @pytest.mark.asyncio
+    async def test_forced_update_restarts_at_splash(self):
+        """Test that a settings change such as a new park starts the queue over"""
+        await self.show_park(make_park([("Alpha", 1, 10), ("Beta", 2, 20)]))
+        mq = self.app.message_queue
+        mq.index = 4
+        self.display.stop_current_operation.reset_mock()
+
+        # The web server selects a different park and flags an update
+        self.service.park_list.current_park = make_park([("Gamma", 3, 5)], park_id=2)
+        self.service.update_needed = True
+        await self.app.update_data(False)
+
+        assert mq.index == 0
+        assert mq.func_queue[0] == self.display.show_splash
+        assert "Gamma" in mq.param_queue and "Alpha" not in mq.param_queue
+        self.display.stop_current_operation.assert_called()
+        assert self.service.update_needed is False
+
+
+class TestDisplayLoop:
+    def setup_method(self):
+        settings_manager = MagicMock()
+        settings_manager.get.side_effect = lambda key, default=None: default
+        self.app = ThemeParkApp(MagicMock(), MagicMock(), settings_manager)
+        self.app.update_data = AsyncMock()
+        # Stop the loop after its first message
+        self.app.message_queue.show = AsyncMock(side_effect=asyncio.CancelledError)
+
+    @pytest.mark.asyncio
+    async def test_updates_data(self):
+        """Test that the loop checks for a data update before each message"""
+        with pytest.raises(asyncio.CancelledError):
+            await self.app.run_display_loop()
+        self.app.update_data.assert_called_once_with(False)
+
+    @pytest.mark.asyncio
+    async def test_quiet_startup_leaves_update_to_initialization(self):
+        """Test that cached startup doesn't start a second rebuild alongside initialize_all()"""
+        self.app.quiet_startup = True
+        with pytest.raises(asyncio.CancelledError):
+            await self.app.run_display_loop()
+        self.app.update_data.assert_not_called()
@@ -404,4 +404,87 @@ class TestMessageQueue:
         # Show should do nothing with an empty queue
         with patch('asyncio.create_task') as mock_create_task:
             await mq.show()
-            mock_create_task.assert_not_called()
\ No newline at end of file
+            mock_create_task.assert_not_called()
+
+def make_park(rides):
+    """Make an open park from (name, id, wait_time, is_open) tuples"""
+    json_data = {"rides": [{"name": name, "id": ride_id, "wait_time": wait, "is_open": is_open}
+                           for name, ride_id, wait, is_open in rides]}
+    return ThemePark(json_data, "Test Park", 1)
+
+
+class TestMessageQueueRebuild:
+    def setup_method(self):
+        self.display = MagicMock()
+        self.settings = {"sort_mode": "alphabetical", "group_by_park": False}
+        self.display.settings_manager.get.side_effect = lambda key, default=None: self.settings.get(key, default)
+        self.mq = MessageQueue(self.display)
+        self.park_list = MagicMock(spec=ThemeParkList)
+        self.park_list.skip_closed = True
+        self.park_list.skip_meet = False
+
+    async def build(self, park):
+        self.park_list.current_park = park
+        await self.mq.add_splash(4, True)
+        await self.mq.add_rides(self.park_list)
+
+    async def rebuild(self, park):
+        self.mq.begin_rebuild()
+        await self.build(park)
+        self.mq.apply_rebuild()
+
+    @pytest.mark.asyncio
+    async def test_wait_time_change_is_patched_in_place(self):
+        """Test that a changed wait time updates its entry without resetting the queue"""
+        await self.build(make_park([("Alpha", 1, 10, True), ("Beta", 2, 20, True)]))
+        funcs = self.mq.func_queue
+        params = self.mq.param_queue
+        self.mq.index = 3
+        self.display.stop_current_operation.reset_mock()
+
+        await self.rebuild(make_park([("Alpha", 1, 10, True), ("Beta", 2, 35, True)]))
+
+        assert self.mq.func_queue is funcs
+        assert self.mq.param_queue is params
+        assert params == [(4, True), "10", "Alpha", "35", "Beta"]
+        assert self.mq.index == 3
+        self.display.stop_current_operation.assert_not_called()
+
+    @pytest.mark.asyncio
+    async def test_rides_opening_and_closing(self):
+        """Test that only the entries of rides that closed or opened change"""
+        await self.build(make_park([("Alpha", 1, 10, True), ("Beta", 2, 20, True), ("Gamma", 3, 0, False)]))
+        # Next up is Beta's wait time
+        self.mq.index = 3
+
+        await self.rebuild(make_park([("Alpha", 1, 0, False), ("Beta", 2, 20, True), ("Gamma", 3, 5, True)]))
+
+        assert self.mq.param_queue == [(4, True), "20", "Beta", "5", "Gamma"]
+        assert len(self.mq.func_queue) == len(self.mq.delay_queue) == len(self.mq.key_queue) == 5
+        assert self.mq.index == 1
+
+    @pytest.mark.asyncio
+    async def test_reordered_queue_keeps_the_cursor(self):
+        """Test that a resorted queue is replaced and the cursor follows its entry"""
+        self.settings["sort_mode"] = "max_wait"
+        await self.build(make_park([("Alpha", 1, 10, True), ("Beta", 2, 20, True)]))
+        funcs = self.mq.func_queue
+        # Next up is Alpha's wait time
+        self.mq.index = 3
+
+        await self.rebuild(make_park([("Alpha", 1, 30, True), ("Beta", 2, 20, True)]))
+
+        assert self.mq.func_queue is funcs
+        assert self.mq.param_queue == [(4, True), "30", "Alpha", "20", "Beta"]
+        assert self.mq.index == 1
+
+    @pytest.mark.asyncio
+    async def test_removed_cursor_entry_moves_to_next_survivor(self):
+        """Test the cursor when the entry due next is gone"""
+        await self.build(make_park([("Alpha", 1, 10, True), ("Beta", 2, 20, True)]))
+        self.mq.index = 4
+
+        await self.rebuild(make_park([("Alpha", 1, 10, True)]))
+
+        assert self.mq.param_queue == [(4, True), "10", "Alpha"]
+        assert self.mq.index == 0
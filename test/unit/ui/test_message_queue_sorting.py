@@ -44,13 +44,28 @@ class TestMessageQueueSorting:
         self.park.rides = self.rides
         self.park.is_open = True
     
-    def test_sort_rides_alphabetical(self):
+    async def _sorted_names(self, sort_mode):
+        """Queue the test park's rides in one sort mode and read back the order"""
+        mock_park_list = MagicMock()
+        mock_park_list.selected_parks = [self.park]
+        mock_park_list.skip_meet = False
+        mock_park_list.skip_closed = False
+        self.mock_settings_manager.get.side_effect = lambda key, default=None: {
+            "sort_mode": sort_mode,
+            "group_by_park": False
+        }.get(key, default)
+        
+        await self.message_queue.add_rides(mock_park_list)
+        
+        return [self.message_queue.param_queue[i]
+                for i, func in enumerate(self.message_queue.func_queue)
+                if func == self.mock_display.show_ride_name]
+    
+    @pytest.mark.asyncio
+    async def test_sort_rides_alphabetical(self):
         """Test alphabetical sorting"""
-        rides_with_parks = [(ride, self.park) for ride in self.rides]
-        sorted_rides = self.message_queue._sort_rides(rides_with_parks, "alphabetical")
+        sorted_names = await self._sorted_names("alphabetical")
         
-        # Extract ride names
-        sorted_names = [ride[0].name for ride in sorted_rides]
         expected_names = [
             "Big Thunder Mountain",
             "Haunted Mansion", 
@@ -61,33 +76,42 @@ class TestMessageQueueSorting:
         ]
         assert sorted_names == expected_names
     
-    def test_sort_rides_max_wait(self):
-        """Test sorting by longest wait time first"""
-        rides_with_parks = [(ride, self.park) for ride in self.rides]
-        sorted_rides = self.message_queue._sort_rides(rides_with_parks, "max_wait")
-        
-        # Extract wait times (closed rides should be 0)
-        wait_times = [ride[0].wait_time if ride[0].is_open() else 0 for ride in sorted_rides]
-        expected_times = [60, 45, 30, 20, 15, 0]  # Descending order
-        assert wait_times == expected_times
+    @pytest.mark.asyncio
+    async def test_sort_rides_max_wait(self):
+        """Test sorting by longest wait time first (closed rides count as 0)"""
+        sorted_names = await self._sorted_names("max_wait")
+        
+        expected_names = [
+            "Space Mountain",
+            "Haunted Mansion",
+            "Big Thunder Mountain",
+            "Meet Mickey",
+            "Pirates of the Caribbean",
+            "Matterhorn"
+        ]
+        assert sorted_names == expected_names
     
-    def test_sort_rides_min_wait(self):
-        """Test sorting by shortest wait time first"""
-        rides_with_parks = [(ride, self.park) for ride in self.rides]
-        sorted_rides = self.message_queue._sort_rides(rides_with_parks, "min_wait")
-        
-        # Extract wait times (closed rides should be 0)
-        wait_times = [ride[0].wait_time if ride[0].is_open() else 0 for ride in sorted_rides]
-        expected_times = [0, 15, 20, 30, 45, 60]  # Ascending order
-        assert wait_times == expected_times
+    @pytest.mark.asyncio
+    async def test_sort_rides_min_wait(self):
+        """Test sorting by shortest wait time first (closed rides count as 0)"""
+        sorted_names = await self._sorted_names("min_wait")
+        
+        expected_names = [
+            "Matterhorn",
+            "Pirates of the Caribbean",
+            "Meet Mickey",
+            "Big Thunder Mountain",
+            "Haunted Mansion",
+            "Space Mountain"
+        ]
+        assert sorted_names == expected_names
     
-    def test_sort_rides_unknown_mode(self):
+    @pytest.mark.asyncio
+    async def test_sort_rides_unknown_mode(self):
         """Test that unknown sort mode defaults to alphabetical"""
-        rides_with_parks = [(ride, self.park) for ride in self.rides]
-        sorted_rides = self.message_queue._sort_rides(rides_with_parks, "invalid_mode")
+        sorted_names = await self._sorted_names("invalid_mode")
         
         # Should default to alphabetical
-        sorted_names = [ride[0].name for ride in sorted_rides]
         assert sorted_names[0] == "Big Thunder Mountain"
         assert sorted_names[-1] == "Space Mountain"
     
@@ -0,0 +1,107 @@
+"""
+Tests for time-based text scrolling.
+"""
+import pytest
+
+from src.ui.text_scroller import TextScroller, NS_PER_SECOND
+
+
+def ns(seconds):
+    """Convert seconds to a time.monotonic_ns() value"""
+    return round(seconds * NS_PER_SECOND)
+
+
+class FakeLabel:
+    """Minimal label with the attributes the scroller uses"""
+    
+    def __init__(self, text="Space Mountain", width=56, x=0):
+        self.text = text
+        self.x = x
+        self.bounding_box = (0, 0, width, 8)
+
+
+class TestTextScroller:
+    def test_moves_by_elapsed_time(self):
+        """Test that position follows the clock, not the call count"""
+        label = FakeLabel(x=64)
+        scroller = TextScroller(label, 64, speed=25.0)
+        
+        assert scroller.advance(now_ns=ns(10.0)) is True
+        assert label.x == 64
+        
+        # Many calls within one pixel's worth of time don't move the label
+        for t in (10.01, 10.02, 10.03):
+            scroller.advance(now_ns=ns(t))
+        assert label.x == 64
+        
+        scroller.advance(now_ns=ns(10.2))
+        assert label.x == 59
+        
+    def test_fractional_speed(self):
+        """Test that sub-pixel speeds accumulate"""
+        label = FakeLabel(x=0)
+        scroller = TextScroller(label, 64, speed=2.5)
+        scroller.advance(now_ns=ns(0.0))
+        for frame in range(1, 61):
+            scroller.advance(now_ns=ns(frame / 60))
+        assert label.x == -2
+        for frame in range(61, 121):
+            scroller.advance(now_ns=ns(frame / 60))
+        assert label.x == -5
+        
+    def test_long_uptime_keeps_frame_resolution(self):
+        """Test that 60 fps frames after a month of uptime scroll like at boot"""
+        label = FakeLabel(x=0)
+        scroller = TextScroller(label, 64, speed=2.5)
+        boot = 30 * 24 * 3600 * NS_PER_SECOND
+        scroller.advance(now_ns=boot)
+        for frame in range(1, 121):
+            scroller.advance(now_ns=boot + frame * NS_PER_SECOND // 60)
+        assert label.x == -5
+        
+    def test_slow_frame_catches_up(self):
+        """Test that a late frame jumps ahead instead of stretching the scroll"""
+        label = FakeLabel(x=0)
+        scroller = TextScroller(label, 64, speed=30.0)
+        scroller.advance(now_ns=ns(0.0))
+        scroller.advance(now_ns=ns(0.2))
+        assert label.x == -6
+        
+    def test_long_stall_is_capped(self):
+        """Test that a long blocking call doesn't skip most of the message"""
+        label = FakeLabel(x=0)
+        scroller = TextScroller(label, 64, speed=20.0, max_catchup=0.25)
+        scroller.advance(now_ns=ns(0.0))
+        scroller.advance(now_ns=ns(5.0))
+        assert label.x == -5
+        
+    def test_finishes_and_resets(self):
+        """Test that the label returns to the right edge when done"""
+        label = FakeLabel(width=10, x=0)
+        scroller = TextScroller(label, 64, speed=60.0)
+        scroller.advance(now_ns=ns(0.0))
+        now = 0.0
+        while scroller.advance(now_ns=ns(now)):
+            now += 0.1
+        assert label.x == 64
+        assert now == pytest.approx(0.2)
+        
+    def test_step_follows_the_label(self):
+        """Test that step keeps one scroller per line and text and drops it when done"""
+        label = FakeLabel(width=10, x=20)
+        scroller = TextScroller.step(None, label, 64, 60.0, now_ns=ns(0.0))
+        assert TextScroller.step(scroller, label, 64, 60.0, now_ns=ns(0.1)) is scroller
+        assert label.x == 14
+        
+        # New text starts a new scroll from where the label is
+        label.text = "Pirates"
+        restarted = TextScroller.step(scroller, label, 64, 60.0, now_ns=ns(0.2))
+        assert restarted is not scroller
+        assert restarted.start_x == 14
+        
+        now = 0.2
+        while restarted:
+            now += 0.1
+            restarted = TextScroller.step(restarted, label, 64, 60.0, now_ns=ns(now))
+        assert label.x == 64
+        assert now == pytest.approx(0.7)
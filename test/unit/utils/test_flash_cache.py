@@ -0,0 +1,71 @@
+"""
+Tests for the on-flash response cache.
+"""
+import os
+import time
+from unittest.mock import patch
+
+from src.utils.flash_cache import FlashCache
+
+
+class TestFlashCache:
+    def test_save_and_load(self, tmp_path):
+        """Test that saved data comes back from a new cache instance"""
+        directory = str(tmp_path / "cache")
+        assert FlashCache(directory).save("parks", [[1, "Park", 1.5, -2.0]])
+
+        cache = FlashCache(directory)
+        assert cache.load("parks") == [[1, "Park", 1.5, -2.0]]
+        saved, data = cache.load_entry("parks")
+        assert saved <= time.time()
+        assert cache.load("missing") is None
+
+    def test_writes_are_throttled(self, tmp_path):
+        """Test that a key isn't rewritten within min_interval"""
+        cache = FlashCache(str(tmp_path), min_interval=60)
+        assert cache.save("park_1", [1])
+        assert not cache.save("park_1", [2])
+        assert cache.load("park_1") == [1]
+        assert cache.save("park_1", [3], force=True)
+        assert cache.load("park_1") == [3]
+        assert cache.save("park_2", [4])
+
+    def test_max_age_needs_a_set_clock(self, tmp_path):
+        """Test that old entries are dropped only when the clock is later than the save"""
+        cache = FlashCache(str(tmp_path))
+        with patch('src.utils.flash_cache.time.time', return_value=1000000):
+            cache.save("park_1", [1])
+        with patch('src.utils.flash_cache.time.time', return_value=1000000 + 7200):
+            assert cache.load("park_1", max_age=3600) is None
+            assert cache.load("park_1", max_age=10000) == [1]
+        # A clock that hasn't been set yet reads earlier than the save
+        with patch('src.utils.flash_cache.time.time', return_value=100):
+            assert cache.load("park_1", max_age=3600) == [1]
+
+    def test_interrupted_swap_keeps_previous_entry(self, tmp_path):
+        """Test that the temporary file is read when the swap didn't finish"""
+        cache = FlashCache(str(tmp_path))
+        cache.save("parks", ["old"])
+        os.rename(str(tmp_path / "parks.json"), str(tmp_path / "parks.json.tmp"))
+        assert cache.load("parks") == ["old"]
+
+    def test_corrupt_entry_is_ignored(self, tmp_path):
+        """Test that an unreadable entry loads as missing"""
+        (tmp_path / "parks.json").write_text('{"saved": 1, "da')
+        assert FlashCache(str(tmp_path)).load("parks") is None
+
+    def test_read_only_filesystem(self, tmp_path):
+        """Test that a failed write disables saving without raising"""
+        cache = FlashCache(str(tmp_path))
+        with patch('builtins.open', side_effect=OSError(30, "Read-only filesystem")):
+            assert not cache.save("parks", [1])
+        assert not cache.writable
+        assert not cache.save("parks", [1])
+        assert cache.load("parks") is None
+
+    def test_oversized_entry_is_not_written(self, tmp_path):
+        """Test the size limit"""
+        cache = FlashCache(str(tmp_path), max_bytes=64)
+        assert not cache.save("parks", ["x" * 100])
+        assert cache.load("parks") is None
+        assert cache.writable
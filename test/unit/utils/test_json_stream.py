@@ -0,0 +1,98 @@
+"""
+Tests for the streaming JSON reader.
+"""
+import json
+import os
+import pytest
+
+from src.utils.json_stream import JsonStream, ANY
+from src.models.theme_park import ThemePark
+from src.models.theme_park_list import ThemeParkList
+
+FIXTURES_DIR = os.path.join(os.path.dirname(__file__), '..', '..', 'fixtures')
+
+
+def load_fixture(name):
+    """Read a fixture file as bytes"""
+    with open(os.path.join(FIXTURES_DIR, name), 'rb') as f:
+        return f.read()
+
+
+def chunked(data, size):
+    """Split bytes into chunks of the given size"""
+    return [data[i:i + size] for i in range(0, len(data), size)]
+
+
+class TestJsonStream:
+    def test_collects_fields_at_path(self):
+        """Test that only the requested fields of target objects are kept"""
+        data = b'{"a": [{"x": 1, "y": "skip", "z": {"x": 2}}, {"x": -2.5e1, "w": [1, 2]}]}'
+        records = []
+        JsonStream(data).collect({("a", ANY): (("x", "z"), records.append)})
+        assert records == [{"x": 1}, {"x": -25.0}]
+        
+    def test_decodes_strings_and_literals(self):
+        """Test escapes, unicode and literal values"""
+        data = '{"r": [{"s": "a\\"b\\\\c\\n\\u00e9ü", "t": true, "f": false, "n": null}]}'.encode('utf-8')
+        records = []
+        JsonStream(data).collect({("r", ANY): (("s", "t", "f", "n"), records.append)})
+        assert records == [{"s": 'a"b\\c\néü', "t": True, "f": False, "n": None}]
+        
+    def test_decodes_surrogate_pairs(self):
+        """Test that escaped UTF-16 pairs become one character, even across chunks"""
+        data = b'{"r": [{"s": "\\ud83d\\ude80 Ride", "t": "\\ud83dx\\ude80"}]}'
+        for size in (1, 5, len(data)):
+            records = []
+            JsonStream(chunked(data, size)).collect({("r", ANY): (("s", "t"), records.append)})
+            # Unpaired halves have no UTF-8 form and decode as U+FFFD
+            assert records == [{"s": "\U0001F680 Ride", "t": "\ufffdx\ufffd"}]
+        
+    def test_chunk_boundaries(self):
+        """Test that tokens split across chunks parse the same"""
+        data = load_fixture('magic-kingdom.json')
+        whole = ThemePark.parse_stream(data)
+        for size in (1, 3, 7, 64):
+            assert ThemePark.parse_stream(chunked(data, size)) == whole
+        
+    def test_reads_from_file_like(self):
+        """Test reading through a read(size) interface"""
+        import io
+        data = load_fixture('magic-kingdom.json')
+        assert ThemePark.parse_stream(io.BytesIO(data)) == ThemePark.parse_stream(data)
+        
+    @pytest.mark.parametrize("data", [b'{"a": [1, 2}', b'{"a": "open', b'{"a" 1}', b'[1] 2', b'{"a": tru}'])
+    def test_invalid_json_raises(self, data):
+        """Test that malformed input raises ValueError like json.loads"""
+        with pytest.raises(ValueError):
+            JsonStream(data).collect({("a", ANY): (("x",), lambda record: None)})
+
+
+class TestParkPayloads:
+    def test_park_rides_match_full_parse(self):
+        """Test that streamed rides equal the rides from json.loads"""
+        data = load_fixture('magic-kingdom.json')
+        expected = ThemePark(json.loads(data))
+        streamed = ThemePark(ThemePark.parse_stream(chunked(data, 100)))
+        
+        assert len(streamed.rides) == len(expected.rides) > 0
+        for got, want in zip(streamed.rides, expected.rides):
+            assert (got.name, got.id, got.wait_time, got.open_flag) == \
+                (want.name, want.id, want.wait_time, want.open_flag)
+        assert streamed.is_open == expected.is_open
+        
+    def test_direct_rides(self):
+        """Test parks that list rides outside of lands"""
+        data = b'{"lands": [], "rides": [{"id": 7, "name": "Coaster", "is_open": true, "wait_time": 15}]}'
+        park = ThemePark(ThemePark.parse_stream(data))
+        assert [(ride.name, ride.wait_time) for ride in park.rides] == [("Coaster", 15)]
+        
+    def test_park_list_matches_full_parse(self):
+        """Test that the streamed park list equals the full parse"""
+        data = load_fixture('theme-park-list.json')
+        expected = ThemeParkList(json.loads(data))
+        streamed = ThemeParkList(ThemeParkList.parse_stream(chunked(data, 256)))
+        
+        assert len(streamed.park_list) == len(expected.park_list) > 0
+        for got, want in zip(streamed.park_list, expected.park_list):
+            assert (got.name, got.id, got.latitude, got.longitude) == \
+                (want.name, want.id, want.latitude, want.longitude)
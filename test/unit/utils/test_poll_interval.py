@@ -0,0 +1,69 @@
+"""
+Tests for the adaptive poll interval.
+"""
+from unittest.mock import patch
+
+from src.utils.poll_interval import AdaptivePollInterval
+
+
+def no_jitter(**kwargs):
+    """Create a policy with jitter disabled"""
+    return AdaptivePollInterval(jitter=0, **kwargs)
+
+
+class TestAdaptivePollInterval:
+    def test_normal_changes_use_base(self):
+        """Test that ordinary updates poll at the base interval"""
+        policy = no_jitter(base=300)
+        assert policy.update(changed=True, change_rate=1.0) == 300
+        
+    def test_closed_parks_ramp_to_max(self):
+        """Test that nothing open stretches the interval toward the longest"""
+        policy = no_jitter(base=300, max_interval=1800, backoff=2)
+        assert policy.update(changed=True, active=False) == 600
+        assert policy.update(changed=True, active=False) == 1200
+        assert policy.update(changed=True, active=False) == 1800
+        # Back to normal once a park opens
+        assert policy.update(changed=True, active=True) == 300
+        
+    def test_failed_refresh_retries_at_base(self):
+        """Test that an error doesn't back off like unchanged data does"""
+        policy = no_jitter(base=300, backoff=2)
+        policy.update(changed=False)
+        policy.update(changed=False)
+        assert policy.update(changed=False, failed=True) == 300
+        # Closed parks don't stretch a retry either
+        assert policy.update(changed=False, active=False, failed=True) == 300
+        
+    def test_unchanged_data_backs_off_gradually(self):
+        """Test that identical payloads stretch the interval up to the bound"""
+        policy = no_jitter(base=300, max_interval=1000, backoff=2)
+        assert policy.update(changed=False) == 600
+        assert policy.update(changed=False) == 1000
+        assert policy.update(changed=False) == 1000
+        
+    def test_volatile_wait_times_speed_up(self):
+        """Test that fast-moving wait times shorten the interval to the bound"""
+        policy = no_jitter(base=300, min_interval=100, volatile_change=5)
+        assert policy.update(changed=True, change_rate=8) == 150
+        assert policy.update(changed=True, change_rate=8) == 100
+        assert policy.update(changed=True, change_rate=2) == 300
+        
+    def test_jitter_stays_in_bounds(self):
+        """Test that jitter spreads delays without leaving the bounds"""
+        policy = AdaptivePollInterval(base=300, min_interval=280, max_interval=1800, jitter=0.1)
+        delays = [policy.next_delay() for _ in range(200)]
+        assert min(delays) >= 280
+        assert max(delays) <= 330
+        assert len(set(delays)) > 1
+        
+        policy.interval = policy.max_interval
+        with patch('src.utils.poll_interval.random.uniform', side_effect=lambda low, high: high):
+            assert policy.next_delay() == 1800
+        
+    def test_reset(self):
+        """Test that reset returns to the base interval"""
+        policy = no_jitter(base=300)
+        policy.update(changed=False)
+        policy.reset()
+        assert policy.next_delay() == 300